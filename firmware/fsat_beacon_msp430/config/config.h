@@ -139,6 +139,9 @@
 #define RADIO_SIM_UART_MODE                 USCI_A_UART_MODE
 #define RADIO_SIM_UART_OVERSAMPLING         USCI_A_UART_OVERSAMPLING_BAUDRATE_GENERATION
 
+#define RADIO_SIM_KISS_PORT                 0
+#define RADIO_SIM_RX_MAX_LEN                256
+
 //########################################################
 //-- PA --------------------------------------------------
 //########################################################
@@ -86,6 +86,9 @@
 #define RADIO_SIM_UART_BASE_ADDRESS USCI_A0_BASE
 #define RADIO_SIM_UART_TX_PORT      GPIO_PORT_P2
 #define RADIO_SIM_UART_TX_PIN       GPIO_PIN4
+#define RADIO_SIM_UART_RX_PORT      GPIO_PORT_P2
+#define RADIO_SIM_UART_RX_PIN       GPIO_PIN5
+#define RADIO_SIM_UART_ISR_VECTOR   USCI_A0_VECTOR
 
 //##################################################
 //-- PA --------------------------------------------
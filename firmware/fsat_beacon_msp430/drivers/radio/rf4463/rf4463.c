@@ -169,77 +169,162 @@ bool rf4463_tx_packet(uint8_t *data, uint8_t len)
     return false;
 }
 
+/**
+ * \brief Memory source of rf4463_tx_long_packet.
+ */
+typedef struct
+{
+    uint8_t *data;          /**< Packet. */
+    uint16_t pos;           /**< Next byte to transmit. */
+} rf4463_tx_buffer_t;
+
+/**
+ * \brief Gives the next bytes of a packet stored in memory (rf4463_tx_source).
+ * 
+ * \param ctx is a rf4463_tx_buffer_t struct.
+ * \param data is the array to store the bytes.
+ * \param len is the number of bytes to store.
+ * 
+ * \return The number of bytes stored in data.
+ */
+static uint16_t rf4463_tx_buffer_read(void *ctx, uint8_t *data, uint16_t len)
+{
+    rf4463_tx_buffer_t *buffer = (rf4463_tx_buffer_t *)ctx;
+
+    memcpy(data, &buffer->data[buffer->pos], len);
+    buffer->pos += len;
+
+    return len;
+}
+
 bool rf4463_tx_long_packet(uint8_t *packet, uint16_t len)
 {
     if (len <= RF4463_TX_FIFO_LEN)
     {
         return rf4463_tx_packet(packet, (uint8_t)(len));
     }
-    
+
+    rf4463_tx_buffer_t buffer;
+
+    buffer.data = packet;
+    buffer.pos  = 0;
+
+    return rf4463_tx_stream(len, rf4463_tx_buffer_read, &buffer);
+}
+
+/**
+ * \brief Writes the next bytes of a streamed packet to the TX FIFO.
+ * 
+ * \param source is the source of the packet bytes.
+ * \param ctx is the context of the source.
+ * \param len is the number of bytes to write (up to RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD).
+ * 
+ * \return It can return:
+ *              - true if the bytes were written.
+ *              - false if the source ended before len bytes.
+ *              .
+ */
+static bool rf4463_tx_stream_fill(rf4463_tx_source source, void *ctx, uint16_t len)
+{
+    uint8_t fifo_buffer[RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD];
+
+    if (source(ctx, fifo_buffer, len) != len)
+    {
+        return false;
+    }
+
+    rf4463_write_tx_fifo(fifo_buffer, (uint8_t)len);
+
+    return true;
+}
+
+bool rf4463_tx_stream(uint16_t len, rf4463_tx_source source, void *ctx)
+{
+    debug_print_event_from_module(DEBUG_INFO, RF4463_MODULE_NAME, "Transmitting a packet...\n\r");
+
     // Setting packet size
     uint8_t buf[2];
     buf[0] = (uint8_t)(len);
     buf[1] = (uint8_t)(len >> 8);
-    if (len > 255)
-    {
-        rf4463_set_properties(RF4463_PROPERTY_PKT_FIELD_1_LENGTH_12_8, &buf[1], 1);
-    }
+    rf4463_set_properties(RF4463_PROPERTY_PKT_FIELD_1_LENGTH_12_8, &buf[1], 1);
     rf4463_set_properties(RF4463_PROPERTY_PKT_FIELD_1_LENGTH_7_0, &buf[0], 1);
-    
+
     rf4463_fifo_reset();        // Clear FIFO
-    rf4463_write_tx_fifo(packet, RF4463_TX_FIFO_LEN);
-    uint16_t long_pkt_pos = RF4463_TX_FIFO_LEN;
-    
+
+    // First FIFO fill, in blocks of the refill size
+    uint16_t pos = 0;
+    while((pos < len) && (pos < RF4463_TX_FIFO_LEN))
+    {
+        uint16_t bytes_to_transfer = len - pos;
+
+        if (bytes_to_transfer > RF4463_TX_FIFO_LEN - pos)
+        {
+            bytes_to_transfer = RF4463_TX_FIFO_LEN - pos;
+        }
+
+        if (bytes_to_transfer > RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD)
+        {
+            bytes_to_transfer = RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD;
+        }
+
+        if (!rf4463_tx_stream_fill(source, ctx, bytes_to_transfer))
+        {
+            debug_print_event_from_module(DEBUG_ERROR, RF4463_MODULE_NAME, "The packet source ended before the packet length!\n\r");
+
+            return false;
+        }
+
+        pos += bytes_to_transfer;
+    }
+
     rf4463_clear_interrupts();
-    
-    uint8_t fifo_buffer[RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD];
+
     uint16_t tx_timer = RF4463_TX_TIMEOUT;
-    uint8_t i = 0;
-    
+
     rf4463_enter_tx_mode();
-    
+
     while(tx_timer--)
     {
-        if (rf4463_wait_gpio1())
-        {            
-            uint16_t bytes_to_transfer = len - long_pkt_pos;
-
-            if (bytes_to_transfer <= RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD)
+        if (pos < len)
+        {
+            if (rf4463_wait_gpio1())    // TX FIFO almost empty
             {
-                for(i=0; i<bytes_to_transfer; i++)
+                uint16_t bytes_to_transfer = len - pos;
+
+                if (bytes_to_transfer > RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD)
                 {
-                    fifo_buffer[i] = packet[long_pkt_pos++];
+                    bytes_to_transfer = RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD;
                 }
 
-                rf4463_write_tx_fifo(fifo_buffer, bytes_to_transfer);
-                tx_timer = RF4463_TX_TIMEOUT;
-                
-                while(tx_timer--)
+                if (!rf4463_tx_stream_fill(source, ctx, bytes_to_transfer))
                 {
-                    if (rf4463_wait_nIRQ())         // Wait packet sent interruption
-                    {
-                        return true;
-                    }
+                    debug_print_event_from_module(DEBUG_ERROR, RF4463_MODULE_NAME, "The packet source ended before the packet length!\n\r");
 
-                    rf4463_delay_us(100);
+                    break;
                 }
+
+                pos += bytes_to_transfer;
+                tx_timer = RF4463_TX_TIMEOUT;
             }
-            else
+        }
+        else
+        {
+            if (rf4463_wait_nIRQ())     // Wait packet sent interruption
             {
-                for(i=0; i<RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD; i++)
-                {
-                    fifo_buffer[i] = packet[long_pkt_pos++];
-                }
+                debug_print_event_from_module(DEBUG_INFO, RF4463_MODULE_NAME, "Packet transmitted!\n\r");
 
-                rf4463_write_tx_fifo(fifo_buffer, RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD);
-                tx_timer = RF4463_TX_TIMEOUT;
+                return true;
             }
+
+            rf4463_delay_us(100);
         }
     }
-    
+
+    debug_print_event_from_module(DEBUG_ERROR, RF4463_MODULE_NAME, "Timeout reached during the transmission!\n\r");
+
     // If the packet tranmission takes longer than expected, resets the radio.
     rf4463_init();
-    
+
     return false;
 }
 
@@ -541,10 +626,7 @@ void rf4463_write_tx_fifo(uint8_t *data, uint8_t len)
 
     debug_print_msg("\n\r");
 
-    uint8_t buffer[RF4463_TX_FIFO_LEN];
-    memcpy(buffer, data, len);
-
-    rf4463_set_cmd(RF4463_CMD_TX_FIFO_WRITE, buffer, len);
+    rf4463_set_cmd(RF4463_CMD_TX_FIFO_WRITE, data, len);
 }
 
 bool rf4463_read_rx_fifo(uint8_t *data, uint8_t len)
@@ -562,6 +644,34 @@ bool rf4463_read_rx_fifo(uint8_t *data, uint8_t len)
     return true;
 }
 
+bool rf4463_get_rx_fifo_count(uint8_t *count)
+{
+    uint8_t buffer[3];
+
+    // The reply starts with the CTS byte, followed by RX_FIFO_COUNT and TX_FIFO_SPACE
+    if (!rf4463_get_cmd(RF4463_CMD_FIFO_INFO, buffer, 3))
+    {
+        return false;
+    }
+
+    *count = buffer[1];
+
+    return true;
+}
+
+bool rf4463_rx_fifo_overflowed()
+{
+    uint8_t buffer[3];
+
+    // The reply starts with the CTS byte, followed by CHIP_PEND and CHIP_STATUS
+    if (!rf4463_get_cmd(RF4463_CMD_GET_CHIP_STATUS, buffer, 3))
+    {
+        return false;
+    }
+
+    return (buffer[1] & RF4463_INT_STATUS_FIFO_UNDERFLOW_OVERFLOW_ERROR)? true : false;
+}
+
 void rf4463_fifo_reset()
 {
     debug_print_event_from_module(DEBUG_INFO, RF4463_MODULE_NAME, "Reseting FIFO...\n\r");
@@ -42,6 +42,17 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/**
+ * \brief Source of the bytes of a streamed packet.
+ * 
+ * \param ctx is the context given to rf4463_tx_stream.
+ * \param data is the array to store the next bytes of the packet.
+ * \param len is the number of bytes to store in data.
+ * 
+ * \return The number of bytes stored in data (less than len only at the end of the packet).
+ */
+typedef uint16_t (*rf4463_tx_source)(void *ctx, uint8_t *data, uint16_t len);
+
 /**
  * \brief RF4463 initialization.
  * 
@@ -103,6 +114,25 @@ bool rf4463_tx_packet(uint8_t *data, uint8_t len);
  */
 bool rf4463_tx_long_packet(uint8_t *packet, uint16_t len);
 
+/**
+ * \brief Transmits a packet of any length through RF, pulling its bytes from a source as the TX FIFO empties.
+ * 
+ * The packet is never stored entirely: the FIFO is filled and refilled in blocks of
+ * RF4463_TX_FIFO_ALMOST_EMPTY_THRESHOLD bytes read from the source.
+ * 
+ * \see AN633, Figure 62.
+ * 
+ * \param len is the length of the packet.
+ * \param source is the function that gives the bytes of the packet.
+ * \param ctx is the context given to source.
+ * 
+ * \return It can return:
+ *              - true if the packet was sent.
+ *              - false if the packet was not sent (timeout or source with less than len bytes).
+ *              .
+ */
+bool rf4463_tx_stream(uint16_t len, rf4463_tx_source source, void *ctx);
+
 /**
  * \brief 
  * 
@@ -310,6 +340,27 @@ void rf4463_write_tx_fifo(uint8_t *data, uint8_t len);
  */
 bool rf4463_read_rx_fifo(uint8_t *data, uint8_t len);
 
+/**
+ * \brief Reads the number of bytes available in the RX FIFO.
+ * 
+ * \param[out] count is the number of received bytes in the RX FIFO.
+ * 
+ * \return It can return:
+ *              - true if the FIFO information was read.
+ *              - false if the device is not responding.
+ *              .
+ */
+bool rf4463_get_rx_fifo_count(uint8_t *count);
+
+/**
+ * \brief Checks if the RX FIFO overflowed since the last interrupt clear.
+ * 
+ * Bytes received after an overflow are lost, so the last positions of the packet are not reliable.
+ * 
+ * \return TRUE/FALSE if the RX FIFO overflowed or not.
+ */
+bool rf4463_rx_fifo_overflowed();
+
 /**
  * \brief 
  * 
@@ -34,14 +34,42 @@
  */
 
 #include <drivers/driverlib/driverlib.h>
+#include <src/kiss/kiss.h>
 
 #include "uart_radio_sim.h"
 
+KISS_Receiver uart_radio_sim_rx;
+
+uint8_t uart_radio_sim_rx_buffer[2][UART_RADIO_SIM_RX_MAX_LEN];     // Frame being received and last received frame
+
+/**
+ * \brief Sends a single byte through the UART port, escaping the KISS special characters.
+ * 
+ * \param byte is the byte to send.
+ * 
+ * \return None.
+ */
+static void uart_radio_sim_send_byte(uint8_t byte)
+{
+    uint8_t esc[2];
+    uint8_t n = kiss_escape(&byte, 1, esc);
+    uint8_t i = 0;
+
+    for(i=0; i<n; i++)
+    {
+        USCI_A_UART_transmitData(UART_RADIO_SIM_UART_BASE_ADDRESS, esc[i]);
+    }
+}
+
 uint8_t uart_radio_sim_init(uint8_t init_mode)
 {
     // UART pins init.
     GPIO_setAsPeripheralModuleFunctionInputPin(UART_RADIO_SIM_UART_TX_PORT, RADIO_SIM_UART_TX_PIN);
-    
+    GPIO_setAsPeripheralModuleFunctionInputPin(UART_RADIO_SIM_UART_RX_PORT, UART_RADIO_SIM_UART_RX_PIN);
+
+    kiss_receiver_init(&uart_radio_sim_rx, KISS_TYPE(UART_RADIO_SIM_KISS_PORT, KISS_CMD_DATA), uart_radio_sim_rx_buffer[0],
+                       uart_radio_sim_rx_buffer[1], UART_RADIO_SIM_RX_MAX_LEN);
+
     if (init_mode == UART_RADIO_ONLY_SET_TX_PIN_AS_PERIPHERAL)
     {
         return STATUS_SUCCESS;
@@ -66,6 +94,10 @@ uint8_t uart_radio_sim_init(uint8_t init_mode)
             // Enable UART module
             USCI_A_UART_enable(UART_RADIO_SIM_UART_BASE_ADDRESS);
 
+            // Enable reception
+            USCI_A_UART_clearInterrupt(UART_RADIO_SIM_UART_BASE_ADDRESS, USCI_A_UART_RECEIVE_INTERRUPT);
+            USCI_A_UART_enableInterrupt(UART_RADIO_SIM_UART_BASE_ADDRESS, USCI_A_UART_RECEIVE_INTERRUPT);
+
             return STATUS_SUCCESS;
         }
         else
@@ -75,13 +107,63 @@ uint8_t uart_radio_sim_init(uint8_t init_mode)
     }
 }
 
+void uart_radio_sim_start_frame()
+{
+    USCI_A_UART_transmitData(UART_RADIO_SIM_UART_BASE_ADDRESS, KISS_FEND);
+    uart_radio_sim_send_byte(KISS_TYPE(UART_RADIO_SIM_KISS_PORT, KISS_CMD_DATA));
+}
+
 void uart_radio_sim_send_data(uint8_t *data, uint16_t size)
 {
-    uint8_t i = 0;
+    uint16_t i = 0;
     for(i=0; i<size; i++)
     {
-        USCI_A_UART_transmitData(UART_RADIO_SIM_UART_BASE_ADDRESS, data[i]);
+        uart_radio_sim_send_byte(data[i]);
+    }
+}
+
+void uart_radio_sim_end_frame()
+{
+    USCI_A_UART_transmitData(UART_RADIO_SIM_UART_BASE_ADDRESS, KISS_FEND);
+}
+
+uint16_t uart_radio_sim_available()
+{
+    return kiss_receiver_available(&uart_radio_sim_rx);
+}
+
+uint16_t uart_radio_sim_read(uint8_t *data, uint16_t len)
+{
+    return kiss_receiver_read(&uart_radio_sim_rx, data, len);
+}
+
+#if BEACON_RADIO == UART_SIM
+/**
+ * \brief This is the USCI_A0 interrupt vector service routine.
+ *
+ * UART RX interruption routine: decodes the KISS stream, and a finished data frame swaps the two reception buffers.
+ * A frame received before the previous one is read to the end is dropped.
+ *
+ * \return None.
+ */
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector=UART_RADIO_SIM_UART_ISR_VECTOR
+__interrupt
+#elif defined(__GNUC__)
+__attribute__((interrupt(UART_RADIO_SIM_UART_ISR_VECTOR)))
+#endif
+void USCI_A0_ISR()
+{
+    switch(__even_in_range(UCA0IV, 4))
+    {
+        // Vector 2 - RXIFG
+        case 2:
+            kiss_receiver_push(&uart_radio_sim_rx, USCI_A_UART_receiveData(UART_RADIO_SIM_UART_BASE_ADDRESS));
+            break;
+        default:
+            break;
     }
 }
+#endif // BEACON_RADIO
 
 //! \} End of uart_radio_sim group
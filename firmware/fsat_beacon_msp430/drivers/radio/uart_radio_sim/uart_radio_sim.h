@@ -23,6 +23,11 @@
 /**
  * \brief UART Radio Simulation driver.
  * 
+ * Each transmission goes out as a KISS data frame, and the KISS data frames received in the UART are delivered
+ * as received packets, so the beacon can be attached to any KISS client (see host/tools/kiss_pty.c).
+ * 
+ * The UART is shared with the EPS link (USCI_A0): in UART_SIM builds the receive interrupt belongs to this driver.
+ * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
  * \version 1.0-dev
@@ -46,9 +51,13 @@
 /**
  * \brief Initialization of the UART radio simulation.
  * 
+ * Both modes configure the TX and RX pins as peripheral pins and reset the KISS reception state.
+ * 
  * \param init_mode is the type of initialization. It can be:
- *              - UART_RADIO_ONLY_SET_TX_PIN_AS_PERIPHERAL only configures the TX pin as a peripheral pin.
- *              - UART_RADIO_NORMAL_INITIALIZATION initializates and configures the UART-RADIO-SIM UART port.
+ *              - UART_RADIO_ONLY_SET_TX_PIN_AS_PERIPHERAL does not configure the UART port. The port (USCI_A0) is shared
+ *                with the EPS link, so reception depends on eps_hal_init enabling its RX interrupt.
+ *              - UART_RADIO_NORMAL_INITIALIZATION initializates and configures the UART-RADIO-SIM UART port, and enables
+ *                its RX interrupt.
  *              .
  * 
  * \return Initiazaliton status. It can be:
@@ -59,7 +68,14 @@
 uint8_t uart_radio_sim_init(uint8_t init_mode);
 
 /**
- * \brief Send data through the UART port.
+ * \brief Starts a KISS data frame.
+ * 
+ * \return None.
+ */
+void uart_radio_sim_start_frame();
+
+/**
+ * \brief Send data of the current frame through the UART port (escaping the KISS special characters).
  * 
  * \param data is a pointer to the data to be written in the UART port.
  * \param size is the size of the data to be written in the UART port.
@@ -68,6 +84,33 @@ uint8_t uart_radio_sim_init(uint8_t init_mode);
  */
 void uart_radio_sim_send_data(uint8_t *data, uint16_t size);
 
+/**
+ * \brief Ends the current KISS data frame.
+ * 
+ * \return None.
+ */
+void uart_radio_sim_end_frame();
+
+/**
+ * \brief Verifies if a frame was received.
+ * 
+ * \return The number of bytes of the received frame not read yet (0 if there is no frame).
+ */
+uint16_t uart_radio_sim_available();
+
+/**
+ * \brief Reads the next bytes of the received frame.
+ * 
+ * As from a radio RX FIFO, a frame longer than len is read in several calls. The buffer is released for the next
+ * frame after the last byte is read.
+ * 
+ * \param data is an array to store the bytes.
+ * \param len is the maximum number of bytes to read.
+ * 
+ * \return The number of bytes read.
+ */
+uint16_t uart_radio_sim_read(uint8_t *data, uint16_t len);
+
 #endif // UART_RADIO_SIM_H_
 
 //! \} End of uart_radio_sim group
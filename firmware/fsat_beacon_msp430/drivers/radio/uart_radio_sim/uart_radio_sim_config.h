@@ -43,6 +43,9 @@
 #define UART_RADIO_SIM_UART_BASE_ADDRESS                RADIO_SIM_UART_BASE_ADDRESS
 #define UART_RADIO_SIM_UART_TX_PORT                     RADIO_SIM_UART_TX_PORT
 #define UART_RADIO_SIM_UART_TX_PIN                      RADIO_SIM_UART_TX_PIN
+#define UART_RADIO_SIM_UART_RX_PORT                     RADIO_SIM_UART_RX_PORT
+#define UART_RADIO_SIM_UART_RX_PIN                      RADIO_SIM_UART_RX_PIN
+#define UART_RADIO_SIM_UART_ISR_VECTOR                  RADIO_SIM_UART_ISR_VECTOR
 
 #define UART_RADIO_SIM_UART_CLOCK_SOURCE                RADIO_SIM_UART_CLOCK_SOURCE
 #define UART_RADIO_SIM_UART_CLOCK_PRESCALAR             RADIO_SIM_UART_CLOCK_PRESCALAR
@@ -54,6 +57,10 @@
 #define UART_RADIO_SIM_UART_MODE                        RADIO_SIM_UART_MODE
 #define UART_RADIO_SIM_UART_OVERSAMPLING                RADIO_SIM_UART_OVERSAMPLING
 
+// KISS framing
+#define UART_RADIO_SIM_KISS_PORT                        RADIO_SIM_KISS_PORT     /**< KISS port of the transmitted and accepted data frames. */
+#define UART_RADIO_SIM_RX_MAX_LEN                       RADIO_SIM_RX_MAX_LEN    /**< Longest received frame (longer ones are dropped). */
+
 // Initialization modes
 #define UART_RADIO_ONLY_SET_TX_PIN_AS_PERIPHERAL        0
 #define UART_RADIO_NORMAL_INITIALIZATION                1
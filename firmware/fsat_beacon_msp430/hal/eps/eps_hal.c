@@ -160,8 +160,11 @@ static void eps_push(uint8_t byte)
  *
  * \image html eps_isr.png "EPS ISR flowchart" width=400px
  *
+ * The UART radio simulator shares this USCI and takes over its interrupt in UART_SIM builds.
+ *
  * \return None.
  */
+#if BEACON_RADIO != UART_SIM
 #if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
 #pragma vector=EPS_HAL_UART_ISR_VECTOR
 __interrupt
@@ -180,5 +183,6 @@ void USCI_A0_ISR()
             break;
     }
 }
+#endif // BEACON_RADIO
 
 //! \} End of eps_hal group
@@ -59,6 +59,9 @@
 
 uint8_t radio_mode = RADIO_MODE_STANDBY;
 
+uint8_t radio_eras_first = 0;   // First low-confidence position of the last read
+uint8_t radio_eras_last = 0;    // Last low-confidence position + 1 of the last read
+
 bool radio_init()
 {
     debug_print_event_from_module(DEBUG_INFO, RADIO_HAL_MODULE_NAME, "Initializing device...\n\r");
@@ -144,14 +147,56 @@ void radio_write(uint8_t *data, uint16_t len)
         rf4463_enter_standby_mode();
         radio_mode = RADIO_MODE_STANDBY;
     #elif BEACON_RADIO == UART_SIM
+        uart_radio_sim_start_frame();
         uart_radio_sim_send_data(data, len);
+        uart_radio_sim_end_frame();
+    #endif // BEACON_RADIO
+#else
+    debug_print_event_from_module(DEBUG_WARNING, RADIO_HAL_MODULE_NAME, "TRANSMISSIONS DISABLED!\n\r");
+#endif // BEACON_TX_ENABLED
+}
+
+void radio_write_stream(uint16_t len, radio_tx_source source, void *ctx)
+{
+    debug_print_event_from_module(DEBUG_INFO, RADIO_HAL_MODULE_NAME, "Writing ");
+    debug_print_dec(len);
+    debug_print_msg(" bytes to the buffer...\n\r");
+
+#if BEACON_TX_ENABLED == 1
+    #if BEACON_RADIO == CC1175 || BEACON_RADIO == CC1125
+
+    #elif BEACON_RADIO == SI4063
+
+    #elif BEACON_RADIO == RF4463F30
+        rf4463_tx_stream(len, source, ctx);
+        rf4463_enter_standby_mode();
+        radio_mode = RADIO_MODE_STANDBY;
+    #elif BEACON_RADIO == UART_SIM
+        uint8_t buffer[RADIO_TX_STREAM_BLOCK_SIZE];
+        uint16_t n = 0;
+
+        uart_radio_sim_start_frame();
+
+        while(len > 0)
+        {
+            n = source(ctx, buffer, (len > RADIO_TX_STREAM_BLOCK_SIZE)? RADIO_TX_STREAM_BLOCK_SIZE : len);
+            if (n == 0)
+            {
+                break;
+            }
+
+            uart_radio_sim_send_data(buffer, n);
+            len -= n;
+        }
+
+        uart_radio_sim_end_frame();
     #endif // BEACON_RADIO
 #else
     debug_print_event_from_module(DEBUG_WARNING, RADIO_HAL_MODULE_NAME, "TRANSMISSIONS DISABLED!\n\r");
 #endif // BEACON_TX_ENABLED
 }
 
-void radio_read(uint8_t *data, uint8_t len)
+bool radio_read(uint8_t *data, uint8_t len)
 {
     if (len > 128)
     {
@@ -162,21 +207,62 @@ void radio_read(uint8_t *data, uint8_t len)
     debug_print_dec(len);
     debug_print_msg(" bytes from buffer...\n\r");
 
+    radio_eras_first = 0;
+    radio_eras_last = 0;
+
 #if BEACON_RADIO == CC1175 || BEACON_RADIO == CC1125
-    return;
+    return true;
 #elif BEACON_RADIO == SI4063
-    return;
+    return true;
 #elif BEACON_RADIO == RF4463F30
+    uint8_t fifo_count = len;
+
+    // After an overrun, the position of the lost bytes is unknown, so none of the FIFO content can be trusted
+    if (rf4463_rx_fifo_overflowed())
+    {
+        debug_print_event_from_module(DEBUG_WARNING, RADIO_HAL_MODULE_NAME, "RX FIFO overrun! Dropping the read...\n\r");
+
+        rf4463_fifo_reset();
+        rf4463_clear_interrupts();
+
+        return false;
+    }
+
+    // Bytes beyond the RX FIFO count never arrived
+    rf4463_get_rx_fifo_count(&fifo_count);
+
+    radio_eras_first = (fifo_count < len)? fifo_count : len;
+    radio_eras_last = len;
+
     rf4463_rx_packet(data, len);
 
     rf4463_clear_interrupts();
 
     radio_enable_rx();  // Returning to RX mode
+
+    return true;
 #elif BEACON_RADIO == UART_SIM
-    return;
+    // A frame shorter than the read is completed with erasures, as a truncated RX FIFO
+    radio_eras_first = uart_radio_sim_read(data, len);
+    radio_eras_last = len;
+
+    return true;
 #endif // BEACON_RADIO
 }
 
+uint8_t radio_get_erasures(uint8_t *eras_pos)
+{
+    uint8_t no_eras = 0;
+    uint16_t i = 0;
+
+    for(i=radio_eras_first; (i<radio_eras_last) && (no_eras<RADIO_MAX_ERASURES); i++)
+    {
+        eras_pos[no_eras++] = i;
+    }
+
+    return no_eras;
+}
+
 void radio_sleep()
 {
     debug_print_event_from_module(DEBUG_INFO, RADIO_HAL_MODULE_NAME, "Entering sleep mode...\n\r");
@@ -242,7 +328,7 @@ bool radio_available()
 #elif BEACON_RADIO == RF4463F30
     return rf4463_wait_nIRQ();
 #elif BEACON_RADIO == UART_SIM
-    return false;
+    return (uart_radio_sim_available() > 0)? true : false;
 #endif // BEACON_RADIO
 }
 
@@ -40,6 +40,27 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/**
+ * \brief Maximum number of low-confidence byte positions reported for each read.
+ */
+#define RADIO_MAX_ERASURES          32
+
+/**
+ * \brief Maximum length of a single transmission (13-bit packet length field of the RF4463).
+ */
+#define RADIO_TX_MAX_LEN            8191
+
+/**
+ * \brief Source of the bytes of a streamed packet (see radio_write_stream).
+ * 
+ * \param ctx is the context given to radio_write_stream.
+ * \param data is the array to store the next bytes of the packet.
+ * \param len is the number of bytes to store in data.
+ * 
+ * \return The number of bytes stored in data (less than len only at the end of the packet).
+ */
+typedef uint16_t (*radio_tx_source)(void *ctx, uint8_t *data, uint16_t len);
+
 /**
  * \brief Radio modes.
  */
@@ -74,15 +95,40 @@ void radio_reset();
  */
 void radio_write(uint8_t *data, uint16_t len);
 
+/**
+ * \brief Writes a packet to the radio module, pulling its bytes from a source while it is transmitted.
+ * 
+ * \param len is the length of the packet (up to RADIO_TX_MAX_LEN bytes).
+ * \param source is the function that gives the bytes of the packet.
+ * \param ctx is the context given to source.
+ * 
+ * \return None.
+ */
+void radio_write_stream(uint16_t len, radio_tx_source source, void *ctx);
+
 /**
  * \brief Reads data from the radio module buffer.
  * 
+ * After a RX FIFO overrun the read is dropped: the FIFO is flushed and nothing is stored in data.
+ * 
  * \param[in,out] data is an array to store the received data.
  * \param[in] len is the number of bytes to read from the radio buffer.
  * 
- * \return None.
+ * \return TRUE/FALSE if the data was read or dropped.
+ */
+bool radio_read(uint8_t *data, uint8_t len);
+
+/**
+ * \brief Gives the low-confidence byte positions of the last radio_read().
+ * 
+ * These are bytes that the radio did not deliver (ex.: bytes beyond the RX FIFO count).
+ * They can be passed to the FEC decoder as erasures.
+ * 
+ * \param[out] eras_pos is an array to store the positions (RADIO_MAX_ERASURES bytes), in ascending order.
+ * 
+ * \return The number of positions stored in eras_pos.
  */
-void radio_read(uint8_t *data, uint8_t len);
+uint8_t radio_get_erasures(uint8_t *eras_pos);
 
 /**
  * \brief Put the radio to sleep.
@@ -43,6 +43,8 @@
 
 #define RADIO_HAL_RX_ISR_PORT_VECTOR        RADIO_GPIO_nIRQ_ISR_VECTOR
 
+#define RADIO_TX_STREAM_BLOCK_SIZE          48      /**< Bytes pulled at once from a streamed packet source (when the radio driver has no streaming TX). */
+
 #endif // RADIO_HAL_CONFIG_H_
 
 //! \} End of radio_hal group
@@ -0,0 +1,131 @@
+/*
+ * bench.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Host benchmark harness implementation.
+ * 
+ * Usage: fsat_bench [name] [iterations]
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup host_bench
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "bench.h"
+
+volatile uint32_t bench_sink;
+
+static const Bench benches[] = {
+    {"crc",     bench_crc},
+    {"fsp",     bench_fsp},
+    {"ax25",    bench_ax25},
+    {"ax25_link", bench_ax25_link},
+    {"kiss",    bench_kiss},
+    {"ngham",   bench_ngham},
+};
+
+static uint64_t bench_ns()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t bench_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+void bench_start(BenchTimer *timer)
+{
+    timer->cycles   = bench_cycles();
+    timer->ns       = bench_ns();
+}
+
+void bench_stop(BenchTimer *timer, const char *name, uint32_t iterations, uint32_t bytes)
+{
+    uint64_t ns     = bench_ns() - timer->ns;
+    uint64_t cycles = bench_cycles() - timer->cycles;
+
+    printf("%-40s %10.1f ns/op %10.1f cycles/op", name, (double)ns/iterations, (double)cycles/iterations);
+
+    if (bytes > 0)
+    {
+        printf(" %10.1f MB/s", ((double)bytes*iterations*1000.0)/ns);
+    }
+
+    printf("\n");
+}
+
+void bench_check(int cond, const char *expr, const char *file, int line)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+
+        exit(EXIT_FAILURE);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = (argc > 1)? argv[1] : "";
+    uint32_t iterations = (argc > 2)? (uint32_t)strtoul(argv[2], NULL, 0) : BENCH_DEFAULT_ITERATIONS;
+
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+
+    uint16_t i = 0;
+    for(i=0; i<sizeof(benches)/sizeof(benches[0]); i++)
+    {
+        if (strstr(benches[i].name, filter) != NULL)
+        {
+            benches[i].run(iterations);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+//! \} End of host_bench group
@@ -0,0 +1,114 @@
+/*
+ * bench.h
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Host benchmark harness.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup host_bench Benchmarks
+ * \ingroup host
+ * \{
+ */
+
+#ifndef HOST_BENCH_H_
+#define HOST_BENCH_H_
+
+#include <stdint.h>
+
+#define BENCH_DEFAULT_ITERATIONS    10000
+
+/**
+ * \brief Aborts the benchmark run if a result check fails.
+ */
+#define BENCH_CHECK(cond)           bench_check((cond), #cond, __FILE__, __LINE__)
+
+/**
+ * \brief Benchmark timer.
+ */
+typedef struct
+{
+    uint64_t ns;                    /**< Wall-clock time stamp in nanoseconds. */
+    uint64_t cycles;                /**< CPU time stamp counter (0 if not available). */
+} BenchTimer;
+
+/**
+ * \brief A benchmark entry.
+ */
+typedef struct
+{
+    const char *name;               /**< Benchmark name (used to filter the run). */
+    void (*run)(uint32_t iterations);
+} Bench;
+
+/**
+ * \brief Sink for computed values, to keep the compiler from removing the benchmarked code.
+ */
+extern volatile uint32_t bench_sink;
+
+/**
+ * \brief Starts a benchmark timer.
+ * 
+ * \param timer is a pointer to a BenchTimer struct.
+ * 
+ * \return None.
+ */
+void bench_start(BenchTimer *timer);
+
+/**
+ * \brief Stops a benchmark timer and prints the results.
+ * 
+ * \param timer is a pointer to a started BenchTimer struct.
+ * \param name is the name of the measured operation.
+ * \param iterations is the number of times the operation was executed.
+ * \param bytes is the number of bytes processed per iteration (0 to omit the throughput).
+ * 
+ * \return None.
+ */
+void bench_stop(BenchTimer *timer, const char *name, uint32_t iterations, uint32_t bytes);
+
+/**
+ * \brief Checks a benchmark result, aborting the run on failure.
+ * 
+ * \param cond is the condition to check.
+ * \param expr is the condition text.
+ * \param file is the source file of the check.
+ * \param line is the source line of the check.
+ * 
+ * \return None.
+ */
+void bench_check(int cond, const char *expr, const char *file, int line);
+
+void bench_crc(uint32_t iterations);
+void bench_fsp(uint32_t iterations);
+void bench_ax25(uint32_t iterations);
+void bench_ax25_link(uint32_t iterations);
+void bench_kiss(uint32_t iterations);
+void bench_ngham(uint32_t iterations);
+
+#endif // HOST_BENCH_H_
+
+//! \} End of host_bench group
@@ -0,0 +1,867 @@
+/*
+ * bench_ax25.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief AX.25 benchmarks.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup host_bench
+ * \{
+ */
+
+#include <string.h>
+
+#include <src/ax25/ax25.h>
+
+#include "bench.h"
+
+/**
+ * \brief Bit by bit stuffing (the previous ax25_bit_stuffing), used as reference.
+ * 
+ * \param pkt is the packet to apply the bit stuffing.
+ * \param pkt_len is the length of the packet (in bytes).
+ * \param new_pkt is an array to store the new packet.
+ * \param new_pkt_len is the length of new_pkt (in bytes).
+ * 
+ * \return None.
+ */
+static void bench_ax25_bit_stuffing_ref(uint8_t *pkt, uint16_t pkt_len, uint8_t *new_pkt, uint16_t *new_pkt_len)
+{
+    static uint8_t bits[8*(21+256)+50];
+    uint16_t n = 0;
+    uint8_t ones = 0;
+    uint16_t i = 0;
+    uint8_t j = 0;
+
+    for(i=0; i<pkt_len; i++)
+    {
+        for(j=0; j<8; j++)
+        {
+            bits[n++] = (pkt[i] >> j) & 0x01;
+
+            ones = bits[n-1]? ones + 1 : 0;
+            if (ones == 5)
+            {
+                bits[n++] = 0;
+                ones = 0;
+            }
+        }
+    }
+
+    memset(new_pkt, 0, (n + 7)/8);
+    for(i=0; i<n; i++)
+    {
+        new_pkt[i/8] |= bits[i] << (7 - (i % 8));
+    }
+
+    *new_pkt_len = (n + 7)/8;
+}
+
+/**
+ * \brief Compares ax25_bit_stuffing with the bit by bit reference.
+ * 
+ * \return None.
+ */
+static void bench_ax25_bit_stuffing_check()
+{
+    uint8_t data[21+256];
+    uint8_t out[400];
+    uint8_t ref[400];
+    uint16_t out_len = 0;
+    uint16_t ref_len = 0;
+    uint32_t seed = 1;
+    uint16_t len = 0;
+    uint16_t i = 0;
+
+    for(len=0; len<=sizeof(data); len++)
+    {
+        for(i=0; i<len; i++)
+        {
+            seed = seed*1103515245 + 12345;
+
+            // Long runs of "1" bits (0xFF, 0x7E, 0xFE, etc.) in half of the bytes
+            data[i] = (seed & 0x10000)? (uint8_t)(seed >> 20) : (uint8_t)(0xFF << ((seed >> 24) & 0x03));
+        }
+
+        bench_ax25_bit_stuffing_ref(data, len, ref, &ref_len);
+        ax25_bit_stuffing(data, len, out, &out_len);
+
+        BENCH_CHECK(out_len == ref_len);
+        BENCH_CHECK(memcmp(out, ref, ref_len) == 0);
+    }
+
+    memset(data, 0xFF, sizeof(data));
+    bench_ax25_bit_stuffing_ref(data, sizeof(data), ref, &ref_len);
+    ax25_bit_stuffing(data, sizeof(data), out, &out_len);
+
+    BENCH_CHECK(out_len == ref_len);
+    BENCH_CHECK(memcmp(out, ref, ref_len) == 0);
+}
+
+/**
+ * \brief Bit stream writer (MSB first), for the reference HDLC framer.
+ */
+typedef struct
+{
+    uint8_t *data;          /**< Stream. */
+    uint32_t bits;          /**< Number of bits written. */
+    uint8_t ones;           /**< Consecutive "1" bits written (for the bit stuffing). */
+} BenchBitWriter;
+
+/**
+ * \brief Writes one bit to the stream.
+ * 
+ * \return None.
+ */
+static void bench_hdlc_put_bit(BenchBitWriter *w, uint8_t bit)
+{
+    if (bit)
+    {
+        w->data[w->bits >> 3] |= 0x80 >> (w->bits & 0x07);
+    }
+    else
+    {
+        w->data[w->bits >> 3] &= ~(0x80 >> (w->bits & 0x07));
+    }
+
+    w->bits++;
+}
+
+/**
+ * \brief Writes bytes LSB first, with (stuff = 1) or without bit stuffing.
+ * 
+ * \return None.
+ */
+static void bench_hdlc_put(BenchBitWriter *w, const uint8_t *data, uint16_t len, uint8_t stuff)
+{
+    uint16_t i = 0;
+    uint8_t j = 0;
+
+    for(i=0; i<len; i++)
+    {
+        for(j=0; j<8; j++)
+        {
+            uint8_t bit = (data[i] >> j) & 0x01;
+
+            bench_hdlc_put_bit(w, bit);
+
+            w->ones = bit? w->ones + 1 : 0;
+            if (stuff && (w->ones == 5))
+            {
+                bench_hdlc_put_bit(w, 0);
+                w->ones = 0;
+            }
+        }
+    }
+
+    if (!stuff)
+    {
+        w->ones = 0;
+    }
+}
+
+/**
+ * \brief Bit by bit CRC-16/X.25, used as reference.
+ * 
+ * \return The CRC (inverted).
+ */
+static uint16_t bench_crc16_x25(const uint8_t *data, uint16_t len)
+{
+    uint16_t crc = 0xFFFF;
+    uint16_t i = 0;
+    uint8_t j = 0;
+
+    for(i=0; i<len; i++)
+    {
+        crc ^= data[i];
+        for(j=0; j<8; j++)
+        {
+            crc = (crc & 0x0001)? (crc >> 1) ^ 0x8408 : crc >> 1;
+        }
+    }
+
+    return crc ^ 0xFFFF;
+}
+
+/**
+ * \brief Reference HDLC framer: writes a UI frame (standard 7-byte addresses) followed by a flag.
+ * 
+ * \param w is the bit stream writer.
+ * \param payload is the information field.
+ * \param len is the length of the information field.
+ * \param corrupt flips one bit of the frame after the FCS computation.
+ * 
+ * \return None.
+ */
+static void bench_hdlc_frame(BenchBitWriter *w, const uint8_t *payload, uint16_t len, uint8_t corrupt)
+{
+    const uint8_t adr[] = {'P' << 1, 'Y' << 1, '0' << 1, 'E' << 1, 'F' << 1, 'S' << 1, 0x60 | (1 << 1),
+                           'P' << 1, 'P' << 1, '5' << 1, 'U' << 1, 'F' << 1, 'S' << 1, 0x61};
+    uint8_t frame[AX25_FRAME_MAX_LEN];
+    uint8_t flag = AX25_FLAG;
+    uint16_t frame_len = 0;
+    uint16_t fcs = 0;
+
+    memcpy(frame, adr, sizeof(adr));
+    frame_len = sizeof(adr);
+    frame[frame_len++] = AX25_CTRL_UNNUMBERED_UI;
+    frame[frame_len++] = AX25_PID_NO_LAYER_3;
+    memcpy(&frame[frame_len], payload, len);
+    frame_len += len;
+
+    fcs = bench_crc16_x25(frame, frame_len);
+    frame[frame_len++] = (uint8_t)fcs;
+    frame[frame_len++] = (uint8_t)(fcs >> 8);
+
+    if (corrupt)
+    {
+        frame[frame_len/2] ^= 0x04;
+    }
+
+    bench_hdlc_put(w, frame, frame_len, 1);
+    bench_hdlc_put(w, &flag, 1, 0);
+}
+
+/**
+ * \brief Builds a bit stream of AX.25 frames: frame n has n%200 + 1 bytes of payload filled with n.
+ * 
+ * Every 7th frame is corrupted. The frames are separated by 1 to 3 flags, and idle "1" bits (abort) every 5th frame.
+ * 
+ * \return The number of frames.
+ */
+static uint16_t bench_ax25_stream(uint8_t *stream, uint32_t len)
+{
+    BenchBitWriter w;
+    uint8_t payload[256];
+    uint8_t flag = AX25_FLAG;
+    uint8_t idle = 0xFF;
+    uint16_t n = 0;
+    uint8_t i = 0;
+
+    memset(stream, 0x55, len);
+
+    w.data = stream;
+    w.bits = 3;         // Not byte aligned
+    w.ones = 0;
+
+    for(n=0; (w.bits/8 + 2*AX25_FRAME_MAX_LEN) < len; n++)
+    {
+        for(i=0; i<(n % 3); i++)
+        {
+            bench_hdlc_put(&w, &flag, 1, 0);
+        }
+
+        if (n % 5 == 4)
+        {
+            bench_hdlc_put(&w, &idle, 1, 0);
+            bench_hdlc_put(&w, &flag, 1, 0);
+        }
+
+        if (n == 0)
+        {
+            bench_hdlc_put(&w, &flag, 1, 0);
+        }
+
+        memset(payload, n, n % 200 + 1);
+        bench_hdlc_frame(&w, payload, n % 200 + 1, (n % 7) == 6);
+    }
+
+    return n;
+}
+
+/**
+ * \brief Checks the AX.25 decoder with the frames of the reference HDLC framer.
+ * 
+ * \return None.
+ */
+static void bench_ax25_decode_check(uint8_t *stream, uint32_t len, uint16_t frames)
+{
+    const uint8_t str[] = "123456789";
+    AX25_Decoder decoder;
+    AX25_Packet ax25_pkt;
+    uint16_t ok = 0;
+    uint16_t fail = 0;
+    uint16_t n = 0;
+    uint32_t i = 0;
+    uint16_t j = 0;
+
+    // CRC-16/X.25 check value
+    BENCH_CHECK((ax25_fcs_update(AX25_FCS_INIT, str, 9) ^ 0xFFFF) == 0x906E);
+    BENCH_CHECK(bench_crc16_x25(str, 9) == 0x906E);
+
+    ax25_decoder_init(&decoder);
+
+    for(i=0; i<len; i++)
+    {
+        switch(ax25_decode(&decoder, stream[i], &ax25_pkt))
+        {
+            case AX25_DECODE_OK:
+                // Corrupted frames are skipped
+                if (n % 7 == 6)
+                {
+                    n++;
+                }
+
+                BENCH_CHECK(ax25_pkt.payload.len == n % 200 + 1);
+                for(j=0; j<ax25_pkt.payload.len; j++)
+                {
+                    BENCH_CHECK(ax25_pkt.payload.data[j] == (uint8_t)n);
+                }
+
+                BENCH_CHECK(ax25_pkt.dst_adr.callsign[0] == ('P' << 1));
+                BENCH_CHECK(ax25_pkt.dst_adr.ssid == (0x60 | (1 << 1)));
+                BENCH_CHECK(ax25_pkt.src_adr.callsign[2] == ('5' << 1));
+                BENCH_CHECK(ax25_pkt.control_bits == AX25_CTRL_UNNUMBERED_UI);
+                BENCH_CHECK(ax25_pkt.protocol_id == AX25_PID_NO_LAYER_3);
+
+                ok++;
+                n++;
+                break;
+            case AX25_DECODE_FAIL:
+                BENCH_CHECK(n % 7 == 6);
+
+                fail++;
+                n++;
+                break;
+        }
+    }
+
+    BENCH_CHECK(n == frames);
+    BENCH_CHECK(fail == frames/7);
+    BENCH_CHECK(ok + fail == frames);
+}
+
+/**
+ * \brief Checks the encoder: frame fields and FCS, bit stuffing against the reference HDLC framer, streaming reads of
+ * several sizes and the decoding of the encoded frames.
+ * 
+ * \return None.
+ */
+static void bench_ax25_encoder_check()
+{
+    const uint16_t read_sizes[] = {1, 2, 3, 5, 7, 48, 400};
+    AX25_Packet ax25_pkt;
+    AX25_Packet rx_pkt;
+    AX25_Encoder encoder;
+    AX25_Decoder decoder;
+    BenchBitWriter w;
+    uint8_t data[256];
+    uint8_t str_pkt[AX25_HEADER_STR_LEN+256+AX25_TRAILER_STR_LEN];
+    uint8_t flag = AX25_FLAG;
+    uint8_t ref[400];
+    uint8_t out[400];
+    uint16_t str_pkt_len = 0;
+    uint16_t ref_len = 0;
+    uint16_t out_len = 0;
+    uint16_t len = 0;
+    uint16_t n = 0;
+    uint32_t seed = 3;
+    uint16_t i = 0;
+    uint8_t r = 0;
+
+    for(len=0; len<=256; len++)
+    {
+        for(i=0; i<len; i++)
+        {
+            seed = seed*1103515245 + 12345;
+            data[i] = (seed & 0x10000)? (uint8_t)(seed >> 20) : 0xFF;
+        }
+
+        ax25_beacon_pkt_gen(&ax25_pkt, data, len);
+        ax25_pkt_2_str(&ax25_pkt, str_pkt, &str_pkt_len);
+
+        // Standard frame: 7-byte addresses, extension bit in the last one, FCS over everything between the flags
+        BENCH_CHECK(str_pkt_len == AX25_HEADER_STR_LEN + len + AX25_TRAILER_STR_LEN);
+        BENCH_CHECK(str_pkt[0] == AX25_FLAG);
+        BENCH_CHECK(str_pkt[1] == ('P' << 1));
+        BENCH_CHECK(str_pkt[6] == (' ' << 1));
+        BENCH_CHECK((str_pkt[7] & 0x01) == 0);
+        BENCH_CHECK(str_pkt[14] & 0x01);
+        BENCH_CHECK(bench_crc16_x25(&str_pkt[1], str_pkt_len - 4) == (str_pkt[str_pkt_len-3] | (str_pkt[str_pkt_len-2] << 8)));
+        BENCH_CHECK(str_pkt[str_pkt_len-1] == AX25_FLAG);
+
+        // Flags without bit stuffing, the rest with it, padded with zeros to a byte boundary
+        memset(ref, 0, sizeof(ref));
+        w.data = ref;
+        w.bits = 0;
+        w.ones = 0;
+        bench_hdlc_put(&w, &flag, 1, 0);
+        bench_hdlc_put(&w, &str_pkt[1], str_pkt_len - 2, 1);
+        bench_hdlc_put(&w, &flag, 1, 0);
+        ref_len = (w.bits + 7)/8;
+
+        for(r=0; r<sizeof(read_sizes)/sizeof(read_sizes[0]); r++)
+        {
+            BENCH_CHECK(ax25_encoder_init(&encoder, &ax25_pkt) == ref_len);
+
+            out_len = 0;
+            do
+            {
+                n = ax25_encoder_read(&encoder, &out[out_len], read_sizes[r]);
+                out_len += n;
+            } while(n == read_sizes[r]);
+
+            BENCH_CHECK(out_len == ref_len);
+            BENCH_CHECK(memcmp(out, ref, ref_len) == 0);
+            BENCH_CHECK(ax25_encoder_read(&encoder, out, read_sizes[r]) == 0);
+        }
+
+        // The same packet, from the header template and the payload
+        BENCH_CHECK(ax25_beacon_encoder_init(&encoder, data, len) == ref_len);
+        BENCH_CHECK(ax25_encoder_read(&encoder, out, sizeof(out)) == ref_len);
+        BENCH_CHECK(memcmp(out, ref, ref_len) == 0);
+
+        // Round trip
+        ax25_decoder_init(&decoder);
+        for(i=0; i<out_len; i++)
+        {
+            r = ax25_decode(&decoder, out[i], &rx_pkt);
+            BENCH_CHECK((r == AX25_DECODE_PREFAIL) || ((r == AX25_DECODE_OK) && (i == out_len-1)));
+        }
+
+        BENCH_CHECK(r == AX25_DECODE_OK);
+        BENCH_CHECK(rx_pkt.payload.len == len);
+        BENCH_CHECK(memcmp(rx_pkt.payload.data, data, len) == 0);
+        BENCH_CHECK(memcmp(&rx_pkt.dst_adr, &ax25_pkt.dst_adr, sizeof(AX25_Transfer_Frame_Header)) == 0);
+        BENCH_CHECK(memcmp(&rx_pkt.src_adr, &ax25_pkt.src_adr, sizeof(AX25_Transfer_Frame_Header)) == 0);
+        BENCH_CHECK(rx_pkt.control_bits == ax25_pkt.control_bits);
+        BENCH_CHECK(rx_pkt.protocol_id == ax25_pkt.protocol_id);
+        BENCH_CHECK(rx_pkt.fcs == ax25_pkt.fcs);
+    }
+}
+
+/**
+ * \brief Bit by bit NRZI and G3RUH scrambler, used as reference.
+ * 
+ * \return None.
+ */
+static void bench_g3ruh_ref(uint32_t *lfsr, uint8_t *level, uint8_t *data, uint16_t len)
+{
+    uint16_t i = 0;
+    int8_t j = 0;
+
+    for(i=0; i<len; i++)
+    {
+        uint8_t out = 0;
+
+        for(j=7; j>=0; j--)
+        {
+            uint8_t x;
+
+            if (((data[i] >> j) & 0x01) == 0)
+            {
+                *level ^= 1;
+            }
+
+            x = (*level ^ (*lfsr >> 11) ^ (*lfsr >> 16)) & 0x01;
+            *lfsr = (*lfsr << 1) | x;
+
+            out |= x << j;
+        }
+
+        data[i] = out;
+    }
+}
+
+/**
+ * \brief Checks the NRZI and G3RUH line coding against the bit by bit reference, and with the AX.25 decoder.
+ * 
+ * \return None.
+ */
+static void bench_ax25_g3ruh_check()
+{
+    AX25_G3RUH tx;
+    AX25_G3RUH rx;
+    AX25_Packet ax25_pkt;
+    AX25_Packet rx_pkt;
+    AX25_Encoder encoder;
+    AX25_Decoder decoder;
+    uint8_t data[1024];
+    uint8_t ref[1024];
+    uint8_t line[1024];
+    uint32_t lfsr = 0;
+    uint8_t level = 0;
+    uint32_t seed = 5;
+    uint16_t len = 0;
+    uint16_t i = 0;
+    uint8_t k = 0;
+    uint8_t ok = 0;
+
+    for(i=0; i<sizeof(data); i++)
+    {
+        seed = seed*1103515245 + 12345;
+        data[i] = (uint8_t)(seed >> 16);
+    }
+
+    // In blocks of several sizes, with the line state kept between them
+    memcpy(ref, data, sizeof(data));
+    bench_g3ruh_ref(&lfsr, &level, ref, sizeof(ref));
+
+    memcpy(line, data, sizeof(data));
+    ax25_g3ruh_init(&tx);
+    for(i=0, k=1; i<sizeof(line); i+=len, k++)
+    {
+        len = (i + k < sizeof(line))? k : sizeof(line) - i;
+        ax25_g3ruh_encode(&tx, &line[i], len);
+    }
+
+    BENCH_CHECK(memcmp(line, ref, sizeof(ref)) == 0);
+
+    ax25_g3ruh_init(&rx);
+    ax25_g3ruh_decode(&rx, line, sizeof(line));
+
+    BENCH_CHECK(memcmp(line, data, sizeof(data)) == 0);
+
+    // Encoder output: two packets on a continuous line, received by a descrambler with a random initial state
+    memset(data, 0x5A, 200);
+    ax25_beacon_pkt_gen(&ax25_pkt, data, 200);
+
+    ax25_g3ruh_init(&tx);
+    len = 0;
+    for(k=0; k<2; k++)
+    {
+        uint16_t n = 0;
+
+        ax25_encoder_init(&encoder, &ax25_pkt);
+        ax25_encoder_set_g3ruh(&encoder, &tx);
+        do
+        {
+            n = ax25_encoder_read(&encoder, &line[len], 48);
+            len += n;
+        } while(n == 48);
+    }
+
+    rx.line[0]  = 0xA7;
+    rx.line[1]  = 0x13;
+    rx.line[2]  = 0xF0;
+    rx.level    = 1;
+    ax25_g3ruh_decode(&rx, line, len);
+
+    ax25_decoder_init(&decoder);
+    for(i=0; i<len; i++)
+    {
+        if (ax25_decode(&decoder, line[i], &rx_pkt) == AX25_DECODE_OK)
+        {
+            BENCH_CHECK(rx_pkt.payload.len == 200);
+            BENCH_CHECK(memcmp(rx_pkt.payload.data, data, 200) == 0);
+            ok++;
+        }
+    }
+
+    // The first packet may be lost while the descrambler synchronizes, never the second
+    BENCH_CHECK(ok >= 1);
+}
+
+/**
+ * \brief Decodes the frames of a segmented block and reassembles them.
+ * 
+ * \param stream is the encoded frames.
+ * \param len is the length of stream.
+ * \param reassembler is the reassembler state.
+ * \param skip is the index of a frame to drop before the reassembly (or -1).
+ * \param frames is the number of decoded frames.
+ * \param blocks is the number of complete blocks.
+ * \param fails is the number of discarded blocks.
+ * 
+ * \return None.
+ */
+static void bench_ax25_reassemble(const uint8_t *stream, uint32_t len, AX25_Reassembler *reassembler, int16_t skip, uint16_t *frames, uint16_t *blocks, uint16_t *fails)
+{
+    static AX25_Packet ax25_pkt;
+    AX25_Decoder decoder;
+    uint32_t i = 0;
+
+    *frames = 0;
+    *blocks = 0;
+    *fails = 0;
+
+    ax25_decoder_init(&decoder);
+
+    for(i=0; i<len; i++)
+    {
+        if (ax25_decode(&decoder, stream[i], &ax25_pkt) == AX25_DECODE_OK)
+        {
+            if ((*frames)++ == skip)
+            {
+                continue;
+            }
+
+            switch(ax25_reassemble(reassembler, &ax25_pkt))
+            {
+                case AX25_DECODE_OK:    (*blocks)++;    break;
+                case AX25_DECODE_FAIL:  (*fails)++;     break;
+                default:                                break;
+            }
+        }
+    }
+}
+
+/**
+ * \brief Verifies the segmentation of long blocks in back to back frames, and their reassembly.
+ * 
+ * \return None.
+ */
+static void bench_ax25_segmentation_check()
+{
+    static const uint16_t block_lens[] = {0, 1, 253, 254, 255, 509, 510, 1000, 6000, AX25_SEG_MAX_LEN};
+    static uint8_t block[AX25_SEG_MAX_LEN];
+    static uint8_t rx_block[AX25_SEG_MAX_LEN];
+    static uint8_t stream[48*1024];
+    AX25_Segmenter segmenter;
+    AX25_Reassembler reassembler;
+    uint16_t total = 0;
+    uint16_t frames = 0;
+    uint16_t blocks = 0;
+    uint16_t fails = 0;
+    uint32_t out_len = 0;
+    uint32_t seed = 5;
+    uint16_t n = 0;
+    uint32_t i = 0;
+    uint8_t b = 0;
+
+    for(i=0; i<sizeof(block); i++)
+    {
+        seed = seed*1103515245 + 12345;
+        block[i] = (seed & 0x20000)? (uint8_t)(seed >> 20) : 0xFF;
+    }
+
+    BENCH_CHECK(ax25_segmenter_init(&segmenter, block, AX25_SEG_MAX_LEN + 1, AX25_PID_NO_LAYER_3) == 0);
+
+    for(b=0; b<sizeof(block_lens)/sizeof(block_lens[0]); b++)
+    {
+        uint16_t len = block_lens[b];
+        uint16_t segments = (len <= AX25_SEG_FIRST_DATA_LEN)? 1 : 1 + (len - AX25_SEG_FIRST_DATA_LEN + AX25_SEG_DATA_LEN - 1)/AX25_SEG_DATA_LEN;
+
+        total = ax25_segmenter_init(&segmenter, block, len, AX25_PID_NO_LAYER_3);
+
+        // Read in blocks of the radio FIFO refill size
+        out_len = 0;
+        do
+        {
+            n = ax25_segmenter_read(&segmenter, &stream[out_len], 48);
+            out_len += n;
+        } while(n == 48);
+
+        BENCH_CHECK(out_len == total);
+        BENCH_CHECK(segmenter.segments == segments);
+
+        ax25_reassembler_init(&reassembler, rx_block, sizeof(rx_block));
+        bench_ax25_reassemble(stream, out_len, &reassembler, -1, &frames, &blocks, &fails);
+
+        BENCH_CHECK(frames == segments);
+        BENCH_CHECK(blocks == 1);
+        BENCH_CHECK(fails == 0);
+        BENCH_CHECK(reassembler.len == len);
+        BENCH_CHECK(reassembler.pid == AX25_PID_NO_LAYER_3);
+        BENCH_CHECK(memcmp(rx_block, block, len) == 0);
+
+        // A lost frame (the first, a middle or the last one) discards the block
+        if (segments > 1)
+        {
+            int16_t skips[3] = {0, segments/2, segments-1};
+
+            for(i=0; i<3; i++)
+            {
+                ax25_reassembler_init(&reassembler, rx_block, sizeof(rx_block));
+                bench_ax25_reassemble(stream, out_len, &reassembler, skips[i], &frames, &blocks, &fails);
+
+                BENCH_CHECK(blocks == 0);
+                BENCH_CHECK((skips[i] == segments-1) || (fails >= 1));
+                BENCH_CHECK((skips[i] != segments-1) || (reassembler.active == 1));
+            }
+        }
+    }
+
+    // A block bigger than the reassembly buffer
+    ax25_segmenter_init(&segmenter, block, 1000, AX25_PID_NO_LAYER_3);
+    out_len = ax25_segmenter_read(&segmenter, stream, sizeof(stream));
+
+    ax25_reassembler_init(&reassembler, rx_block, 600);
+    bench_ax25_reassemble(stream, out_len, &reassembler, -1, &frames, &blocks, &fails);
+
+    BENCH_CHECK(blocks == 0);
+    BENCH_CHECK(fails >= 1);
+
+    // A packet without segmentation is a block by itself
+    n = ax25_segmenter_init(&segmenter, block, 1000, AX25_PID_NO_LAYER_3);
+    out_len = ax25_segmenter_read(&segmenter, stream, sizeof(stream));
+    {
+        AX25_Encoder encoder;
+
+        out_len += ax25_encoder_read(&encoder, &stream[out_len], ax25_beacon_encoder_init(&encoder, block, 100));
+    }
+
+    ax25_reassembler_init(&reassembler, rx_block, sizeof(rx_block));
+    bench_ax25_reassemble(stream, out_len, &reassembler, -1, &frames, &blocks, &fails);
+
+    BENCH_CHECK(frames == 5);
+    BENCH_CHECK(blocks == 2);
+    BENCH_CHECK(reassembler.len == 100);
+    BENCH_CHECK(memcmp(rx_block, block, 100) == 0);
+}
+
+void bench_ax25(uint32_t iterations)
+{
+    static uint8_t stream[32*1024];
+    uint16_t frames = 0;
+    uint8_t payload[128];
+    uint8_t pkt[512];
+    uint16_t pkt_len;
+    uint8_t str_pkt[21+256];
+    uint16_t str_pkt_len;
+    AX25_Packet ax25_pkt;
+    BenchTimer timer;
+    uint32_t i = 0;
+
+    ax25_init();
+
+    for(i=0; i<sizeof(payload); i++)
+    {
+        payload[i] = (uint8_t)(i*13 + 1);
+    }
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        ax25_beacon_pkt_gen(&ax25_pkt, payload, sizeof(payload));
+        ax25_encode(&ax25_pkt, pkt, &pkt_len);
+        bench_sink += pkt[pkt_len-1];
+    }
+    bench_stop(&timer, "ax25_beacon_pkt_gen+ax25_encode (128 B)", iterations, sizeof(payload));
+
+    bench_ax25_bit_stuffing_check();
+
+    ax25_pkt_2_str(&ax25_pkt, str_pkt, &str_pkt_len);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_ax25_bit_stuffing_ref(str_pkt, str_pkt_len, pkt, &pkt_len);
+        bench_sink += pkt[pkt_len-1];
+    }
+    bench_stop(&timer, "ax25_bit_stuffing (bit by bit, 148 B)", iterations, str_pkt_len);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        ax25_bit_stuffing(str_pkt, str_pkt_len, pkt, &pkt_len);
+        bench_sink += pkt[pkt_len-1];
+    }
+    bench_stop(&timer, "ax25_bit_stuffing (148 B)", iterations, str_pkt_len);
+
+    bench_ax25_encoder_check();
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        AX25_Encoder encoder;
+        uint16_t len = ax25_encoder_init(&encoder, &ax25_pkt);
+
+        // The RF4463 TX FIFO refill size
+        while(ax25_encoder_read(&encoder, pkt, 48) == 48);
+        bench_sink += pkt[0] + len;
+    }
+    bench_stop(&timer, "ax25_encoder_init+read (128 B, 48 B reads)", iterations, sizeof(payload));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        AX25_Encoder encoder;
+
+        bench_sink += ax25_beacon_encoder_init(&encoder, payload, sizeof(payload));
+    }
+    bench_stop(&timer, "ax25_beacon_encoder_init (128 B)", iterations, sizeof(payload));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        AX25_Encoder encoder;
+
+        ax25_beacon_pkt_gen(&ax25_pkt, payload, sizeof(payload));
+        bench_sink += ax25_encoder_init(&encoder, &ax25_pkt);
+    }
+    bench_stop(&timer, "ax25_beacon_pkt_gen+encoder_init (128 B)", iterations, sizeof(payload));
+
+    bench_ax25_segmentation_check();
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        AX25_Segmenter segmenter;
+
+        bench_sink += ax25_segmenter_init(&segmenter, stream, 1000, AX25_PID_NO_LAYER_3);
+        while(ax25_segmenter_read(&segmenter, pkt, 48) == 48);
+        bench_sink += pkt[0];
+    }
+    bench_stop(&timer, "ax25_segmenter_init+read (1000 B, 48 B reads)", iterations, 1000);
+
+    bench_ax25_g3ruh_check();
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        AX25_G3RUH g3ruh;
+
+        ax25_g3ruh_init(&g3ruh);
+        ax25_g3ruh_encode(&g3ruh, pkt, 48);
+        bench_sink += pkt[47];
+    }
+    bench_stop(&timer, "ax25_g3ruh_encode (48 B)", iterations, 48);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        AX25_G3RUH g3ruh;
+
+        ax25_g3ruh_init(&g3ruh);
+        ax25_g3ruh_decode(&g3ruh, pkt, 48);
+        bench_sink += pkt[47];
+    }
+    bench_stop(&timer, "ax25_g3ruh_decode (48 B)", iterations, 48);
+
+    frames = bench_ax25_stream(stream, sizeof(stream));
+
+    bench_ax25_decode_check(stream, sizeof(stream), frames);
+
+    iterations = (iterations + 99)/100;
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        AX25_Decoder decoder;
+        uint32_t j = 0;
+
+        ax25_decoder_init(&decoder);
+        for(j=0; j<sizeof(stream); j++)
+        {
+            bench_sink += ax25_decode(&decoder, stream[j], &ax25_pkt);
+        }
+    }
+    bench_stop(&timer, "ax25_decode (32 KiB stream)", iterations, sizeof(stream));
+}
+
+//! \} End of host_bench group
@@ -0,0 +1,373 @@
+/*
+ * bench_ax25_link.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief AX.25 connected mode benchmarks.
+ * 
+ * Two data links (the satellite and a ground station) are connected through a lossy channel model: each frame is
+ * encoded (bit stuffing, FCS and flags), may get a flipped bit, and is decoded by the HDLC decoder of the other side.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup host_bench
+ * \{
+ */
+
+#include <string.h>
+
+#include <src/ax25/ax25.h>
+#include <src/ax25/ax25_link.h>
+
+#include "bench.h"
+
+#define BENCH_LINK_QUEUE_LEN        64      /**< Frames in flight in each direction. */
+#define BENCH_LINK_FRAME_LEN        400     /**< Maximum length of an encoded frame. */
+#define BENCH_LINK_BLOCK_LEN        8000    /**< Stored telemetry pulled by the ground station. */
+#define BENCH_LINK_MAX_TICKS        100000  /**< Time limit of a transfer. */
+
+/**
+ * \brief One direction of the channel (frames in flight).
+ */
+typedef struct
+{
+    uint8_t data[BENCH_LINK_QUEUE_LEN][BENCH_LINK_FRAME_LEN];
+    uint16_t len[BENCH_LINK_QUEUE_LEN];
+    uint16_t head;
+    uint16_t count;
+    uint32_t seed;
+    uint8_t loss_pct;           /**< Probability of a corrupted frame (%). */
+    uint32_t frames;            /**< Frames sent. */
+    uint32_t corrupted;         /**< Frames with a flipped bit. */
+} BenchChannel;
+
+/**
+ * \brief A station: its data link, its receiver and the channel to the other station.
+ */
+typedef struct
+{
+    AX25_Link link;
+    AX25_Decoder decoder;
+    BenchChannel *out;
+    uint8_t *rx_data;
+    uint32_t rx_len;
+    uint8_t rx_overflow;
+} BenchStation;
+
+/**
+ * \brief Encodes a frame to the channel (ax25_link_tx).
+ */
+static void bench_link_tx(void *ctx, const AX25_Packet *ax25_packet)
+{
+    BenchStation *st = (BenchStation *)ctx;
+    BenchChannel *ch = st->out;
+    AX25_Encoder encoder;
+    uint16_t slot = 0;
+    uint16_t len = 0;
+
+    BENCH_CHECK(ch->count < BENCH_LINK_QUEUE_LEN);
+    if (ch->count >= BENCH_LINK_QUEUE_LEN)
+    {
+        return;
+    }
+
+    slot = (ch->head + ch->count++) % BENCH_LINK_QUEUE_LEN;
+
+    len = ax25_encoder_init(&encoder, ax25_packet);
+    BENCH_CHECK(len <= BENCH_LINK_FRAME_LEN);
+
+    ch->len[slot] = ax25_encoder_read(&encoder, ch->data[slot], len);
+    ch->frames++;
+
+    ch->seed = ch->seed*1103515245 + 12345;
+    if ((ch->seed >> 16) % 100 < ch->loss_pct)
+    {
+        uint32_t bit = 0;
+
+        ch->seed = ch->seed*1103515245 + 12345;
+        bit = (ch->seed >> 8) % (8*(uint32_t)ch->len[slot]);
+
+        // A bit error anywhere in the frame (the FCS, or the flags, drops it)
+        ch->data[slot][bit/8] ^= 0x80 >> (bit % 8);
+        ch->corrupted++;
+    }
+}
+
+/**
+ * \brief Stores the received data (ax25_link_rx).
+ */
+static void bench_link_rx(void *ctx, const uint8_t *data, uint16_t len)
+{
+    BenchStation *st = (BenchStation *)ctx;
+
+    if (st->rx_len + len > BENCH_LINK_BLOCK_LEN)
+    {
+        st->rx_overflow = 1;
+
+        return;
+    }
+
+    memcpy(&st->rx_data[st->rx_len], data, len);
+    st->rx_len += len;
+}
+
+/**
+ * \brief Delivers the frames in flight until both directions are empty.
+ */
+static void bench_link_run(BenchStation *a, BenchStation *b)
+{
+    static AX25_Packet ax25_pkt;
+
+    while(a->out->count || b->out->count)
+    {
+        BenchStation *src = a->out->count? a : b;
+        BenchStation *dst = (src == a)? b : a;
+        BenchChannel *ch = src->out;
+        uint16_t slot = ch->head;
+        uint16_t i = 0;
+
+        ch->head = (ch->head + 1) % BENCH_LINK_QUEUE_LEN;
+        ch->count--;
+
+        // Each frame starts with its own flag, so the decoder resynchronizes after a corrupted one
+        for(i=0; i<ch->len[slot]; i++)
+        {
+            if (ax25_decode(&dst->decoder, ch->data[slot][i], &ax25_pkt) == AX25_DECODE_OK)
+            {
+                ax25_link_receive(&dst->link, &ax25_pkt);
+            }
+        }
+    }
+}
+
+/**
+ * \brief Initializes the satellite and ground station links and channels.
+ */
+static void bench_link_setup(BenchStation *sat, BenchStation *gs, BenchChannel *down, BenchChannel *up, uint8_t *rx_data, uint8_t window, uint8_t loss_pct)
+{
+    memset(down, 0, sizeof(BenchChannel));
+    memset(up, 0, sizeof(BenchChannel));
+
+    down->seed      = 11;
+    down->loss_pct  = loss_pct;
+    up->seed        = 17;
+    up->loss_pct    = loss_pct;
+
+    ax25_link_init(&sat->link, "PY0EFS", 1, "PP5UF", 0, window, bench_link_tx, bench_link_rx, sat);
+    ax25_link_init(&gs->link, "PP5UF", 0, "PY0EFS", 1, window, bench_link_tx, bench_link_rx, gs);
+
+    sat->link.t1_init   = 4;
+    gs->link.t1_init    = 4;
+
+    ax25_decoder_init(&sat->decoder);
+    ax25_decoder_init(&gs->decoder);
+
+    sat->out            = down;
+    sat->rx_data        = 0;
+    sat->rx_len         = 0;
+    sat->rx_overflow    = 0;
+    gs->out             = up;
+    gs->rx_data         = rx_data;
+    gs->rx_len          = 0;
+    gs->rx_overflow     = 0;
+}
+
+/**
+ * \brief Connects, transfers a block from the satellite to the ground station and disconnects.
+ * 
+ * \return The number of ticks of the transfer (BENCH_LINK_MAX_TICKS if it did not finish).
+ */
+static uint32_t bench_link_transfer(BenchStation *sat, BenchStation *gs, const uint8_t *block)
+{
+    uint32_t written = 0;
+    uint32_t ticks = 0;
+
+    ax25_link_connect(&gs->link);
+
+    for(ticks=0; ticks<BENCH_LINK_MAX_TICKS; ticks++)
+    {
+        bench_link_run(sat, gs);
+
+        if (sat->link.state == AX25_LINK_CONNECTED)
+        {
+            // Fills the queue of the satellite as it empties
+            while(written < BENCH_LINK_BLOCK_LEN)
+            {
+                uint16_t n = (BENCH_LINK_BLOCK_LEN - written > AX25_LINK_N1)? AX25_LINK_N1 : BENCH_LINK_BLOCK_LEN - written;
+
+                if (!ax25_link_write(&sat->link, &block[written], n))
+                {
+                    break;
+                }
+
+                written += n;
+                bench_link_run(sat, gs);
+            }
+
+            if ((written == BENCH_LINK_BLOCK_LEN) && ax25_link_idle(&sat->link))
+            {
+                break;
+            }
+        }
+        else if ((gs->link.state == AX25_LINK_DISCONNECTED) && (ticks > 0))
+        {
+            ax25_link_connect(&gs->link);
+        }
+
+        ax25_link_tick(&sat->link);
+        ax25_link_tick(&gs->link);
+    }
+
+    // The acknowledgement of the last frames is in the satellite, so the ground station has all the data
+    bench_link_run(sat, gs);
+
+    ax25_link_disconnect(&gs->link);
+    while((ticks < BENCH_LINK_MAX_TICKS) && ((gs->link.state != AX25_LINK_DISCONNECTED) || (sat->link.state != AX25_LINK_DISCONNECTED)))
+    {
+        bench_link_run(sat, gs);
+        ax25_link_tick(&sat->link);
+        ax25_link_tick(&gs->link);
+        ticks++;
+    }
+
+    return ticks;
+}
+
+/**
+ * \brief Verifies the transfers with several windows and loss rates.
+ * 
+ * \return None.
+ */
+static void bench_ax25_link_check(uint8_t *block, uint8_t *rx_data)
+{
+    static const uint8_t loss[] = {0, 5, 10, 30};
+    static BenchChannel down;
+    static BenchChannel up;
+    static BenchStation sat;
+    static BenchStation gs;
+    static AX25_Packet ax25_pkt;
+    uint16_t frames = (BENCH_LINK_BLOCK_LEN + AX25_LINK_N1 - 1)/AX25_LINK_N1;
+    uint8_t window = 0;
+    uint8_t l = 0;
+
+    for(window=1; window<=AX25_LINK_WINDOW_MAX; window++)
+    {
+        for(l=0; l<sizeof(loss); l++)
+        {
+            uint32_t ticks = 0;
+
+            bench_link_setup(&sat, &gs, &down, &up, rx_data, window, loss[l]);
+            memset(rx_data, 0, BENCH_LINK_BLOCK_LEN);
+
+            ticks = bench_link_transfer(&sat, &gs, block);
+
+            BENCH_CHECK(ticks < BENCH_LINK_MAX_TICKS);
+            BENCH_CHECK(!gs.rx_overflow);
+            BENCH_CHECK(gs.rx_len == BENCH_LINK_BLOCK_LEN);
+            BENCH_CHECK(memcmp(rx_data, block, BENCH_LINK_BLOCK_LEN) == 0);
+            BENCH_CHECK(sat.link.state == AX25_LINK_DISCONNECTED);
+            BENCH_CHECK(gs.link.state == AX25_LINK_DISCONNECTED);
+
+            if (loss[l] == 0)
+            {
+                BENCH_CHECK(sat.link.retransmissions == 0);
+            }
+            else
+            {
+                // Selective retransmission: about one retransmission per corrupted frame in any direction
+                BENCH_CHECK(sat.link.retransmissions <= 2*(down.corrupted + up.corrupted));
+                BENCH_CHECK(sat.link.retransmissions < frames);
+            }
+        }
+    }
+
+    // I frames to a disconnected station are answered with a DM
+    bench_link_setup(&sat, &gs, &down, &up, rx_data, AX25_LINK_WINDOW, 0);
+
+    gs.link.state = AX25_LINK_CONNECTED;
+    BENCH_CHECK(ax25_link_write(&gs.link, block, 10) == 1);
+    bench_link_run(&sat, &gs);
+
+    BENCH_CHECK(gs.link.state == AX25_LINK_DISCONNECTED);
+    BENCH_CHECK(sat.rx_len == 0);
+
+    // Frames to other stations are ignored
+    ax25_link_connect(&gs.link);
+    bench_link_run(&sat, &gs);
+    BENCH_CHECK(sat.link.state == AX25_LINK_CONNECTED);
+
+    ax25_set_address(&ax25_pkt.dst_adr, "PY0EFS", AX25_ADR_NON_REPEATER_SSID | (2 << 1) | AX25_ADR_DST_COMMAND);
+    ax25_set_address(&ax25_pkt.src_adr, "PP5UF", AX25_ADR_NON_REPEATER_SSID | AX25_ADR_LAST_ADDRESS);
+    ax25_pkt.control_bits = AX25_CTRL_UNNUMBERED_DISC | AX25_CTRL_PF_TRUE;
+    ax25_link_receive(&sat.link, &ax25_pkt);
+
+    BENCH_CHECK(sat.link.state == AX25_LINK_CONNECTED);
+    BENCH_CHECK(down.count == 0);
+
+    // Without any answer, the connection is given up after N2 retries
+    bench_link_setup(&sat, &gs, &down, &up, rx_data, AX25_LINK_WINDOW, 0);
+
+    ax25_link_connect(&gs.link);
+    for(l=0; l<(AX25_LINK_N2 + 2)*4; l++)
+    {
+        up.count = 0;
+        ax25_link_tick(&gs.link);
+    }
+
+    BENCH_CHECK(gs.link.state == AX25_LINK_DISCONNECTED);
+}
+
+void bench_ax25_link(uint32_t iterations)
+{
+    static uint8_t block[BENCH_LINK_BLOCK_LEN];
+    static uint8_t rx_data[BENCH_LINK_BLOCK_LEN];
+    static BenchChannel down;
+    static BenchChannel up;
+    static BenchStation sat;
+    static BenchStation gs;
+    BenchTimer timer;
+    uint32_t seed = 7;
+    uint32_t i = 0;
+
+    for(i=0; i<sizeof(block); i++)
+    {
+        seed = seed*1103515245 + 12345;
+        block[i] = (uint8_t)(seed >> 16);
+    }
+
+    bench_ax25_link_check(block, rx_data);
+
+    iterations = (iterations + 99)/100;
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_link_setup(&sat, &gs, &down, &up, rx_data, AX25_LINK_WINDOW, 10);
+        bench_sink += bench_link_transfer(&sat, &gs, block);
+    }
+    bench_stop(&timer, "ax25_link transfer (8000 B, 10% loss)", iterations, sizeof(block));
+}
+
+//! \} End of host_bench group
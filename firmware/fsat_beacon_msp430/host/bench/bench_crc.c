@@ -0,0 +1,258 @@
+/*
+ * bench_crc.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief CRC benchmarks.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup host_bench
+ * \{
+ */
+
+#include <src/crc/crc.h>
+#include <src/ngham/crc_ccitt.h>
+
+#include "bench.h"
+
+/**
+ * \brief Byte at a time reference of the table driven CRC-16/X-25 (the MSP430 build path, CRC_SLICES = 1).
+ *
+ * \param data is the data.
+ * \param len is the length of the data.
+ *
+ * \return The CRC value of the data.
+ */
+static uint16_t bench_crc16_x25_bytewise(const uint8_t *data, uint16_t len)
+{
+    uint16_t crc = 0xFFFF;
+
+    while(len--)
+    {
+        crc = (crc >> 8) ^ crc16_ccitt_reflected_table[0][(uint8_t)crc ^ *data++];
+    }
+
+    return crc ^ 0xFFFF;
+}
+
+/**
+ * \brief Bitwise CRC8-CCITT of a time counter (the time_crc8 implementation before the lookup table).
+ *
+ * \param time_counter is the time counter.
+ *
+ * \return The CRC8 value of the time counter (MSB first).
+ */
+static uint8_t bench_time_crc8_bitwise(uint32_t time_counter)
+{
+    uint8_t crc = 0x00;
+    uint8_t i = 0;
+    uint8_t j = 0;
+
+    for(i=0; i<4; i++)
+    {
+        crc ^= (uint8_t)(time_counter >> (24 - 8*i));
+        for(j=0; j<8; j++)
+        {
+            crc = (crc << 1) ^ ((crc & 0x80)? CRC8_CCITT_POLYNOMIAL : 0);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * \brief CRC8-CCITT of a time counter with the lookup table (as time_crc8 in system/time/time.c).
+ *
+ * \param time_counter is the time counter.
+ *
+ * \return The CRC8 value of the time counter (MSB first).
+ */
+static uint8_t bench_time_crc8(uint32_t time_counter)
+{
+    uint8_t time_in_bytes[4];
+
+    time_in_bytes[0] = (uint8_t)(time_counter >> 24);
+    time_in_bytes[1] = (uint8_t)(time_counter >> 16);
+    time_in_bytes[2] = (uint8_t)(time_counter >> 8);
+    time_in_bytes[3] = (uint8_t)time_counter;
+
+    return crc8(0x00, CRC8_CCITT_POLYNOMIAL, time_in_bytes, 4);
+}
+
+/**
+ * \brief Checks the CRC engine against the catalogue check values, the bitwise computation and split updates.
+ *
+ * \return None.
+ */
+static void bench_crc_check()
+{
+    // Catalogue models (check value of "123456789"), computed bitwise
+    const CRC_Model ccitt_false = {16, 0x1021, 0xFFFF, 0x0000, false, NULL};
+    const CRC_Model kermit      = {16, 0x1021, 0x0000, 0x0000, true, NULL};
+    const CRC_Model riello      = {16, 0x1021, 0xB2AA, 0x0000, true, NULL};
+    const CRC_Model smbus       = {8, 0x07, 0x00, 0x00, false, NULL};
+    const CRC_Model maxim       = {8, 0x31, 0x00, 0x00, true, NULL};
+    const CRC_Model xmodem_bit  = {16, 0x1021, 0x0000, 0x0000, false, NULL};
+    const CRC_Model x25_bit     = {16, 0x1021, 0xFFFF, 0xFFFF, true, NULL};
+    const uint8_t *check = (const uint8_t*)"123456789";
+    uint8_t data[300];
+    uint16_t len = 0;
+    uint16_t i = 0;
+
+    BENCH_CHECK(crc_compute(&crc16_xmodem, check, 9) == 0x31C3);
+    BENCH_CHECK(crc_compute(&crc16_x25, check, 9) == 0x906E);
+    BENCH_CHECK(crc_compute(&xmodem_bit, check, 9) == 0x31C3);
+    BENCH_CHECK(crc_compute(&x25_bit, check, 9) == 0x906E);
+    BENCH_CHECK(crc_compute(&ccitt_false, check, 9) == 0x29B1);
+    BENCH_CHECK(crc_compute(&kermit, check, 9) == 0x2189);
+    BENCH_CHECK(crc_compute(&riello, check, 9) == 0x63D0);
+    BENCH_CHECK(crc_compute(&smbus, check, 9) == 0xF4);
+    BENCH_CHECK(crc_compute(&maxim, check, 9) == 0xA1);
+
+    // CRC-16/XMODEM check value of "123456789"
+    BENCH_CHECK(crc16_CCITT(0x0000, (uint8_t*)"123456789", 9) == 0x31C3);
+    BENCH_CHECK(ngham_CRC_CCITT((uint8_t*)"123456789", 9) == 0x906E);
+    BENCH_CHECK(crc8(0x00, CRC8_CCITT_POLYNOMIAL, (uint8_t*)"123456789", 9) == 0xF4);
+    BENCH_CHECK(crc8(0x00, 0x31, (uint8_t*)"123456789", 9) == 0xA2);
+    BENCH_CHECK(crc16(0x0000, 0x21, (uint8_t*)"123456789", 9) == crc_compute(&(CRC_Model){16, 0x21, 0, 0, false, NULL}, check, 9));
+
+    for(i=0; i<sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i*37 + 11);
+    }
+
+    // The CRC8 table against the bitwise time counter checksum
+    {
+        uint32_t t = 0;
+
+        for(t=0; t<0x01000000; t+=0x3F1)
+        {
+            BENCH_CHECK(bench_time_crc8(t * 0x9E + 0x17) == bench_time_crc8_bitwise(t * 0x9E + 0x17));
+        }
+    }
+
+    // The slice-by-N path against the bitwise computation, for every length and alignment
+    for(len=0; len<=64; len++)
+    {
+        for(i=0; i<4; i++)
+        {
+            BENCH_CHECK(crc_compute(&crc16_xmodem, &data[i], len) == crc_compute(&xmodem_bit, &data[i], len));
+            BENCH_CHECK(crc_compute(&crc16_x25, &data[i], len) == crc_compute(&x25_bit, &data[i], len));
+            BENCH_CHECK(crc_compute(&crc16_x25, &data[i], len) == bench_crc16_x25_bytewise(&data[i], len));
+        }
+    }
+
+    // Incremental updates, split at every position
+    for(i=0; i<=sizeof(data); i++)
+    {
+        uint16_t crc = crc_init(&crc16_x25);
+
+        crc = crc_update(&crc16_x25, crc, data, i);
+        crc = crc_update(&crc16_x25, crc, &data[i], sizeof(data) - i);
+        BENCH_CHECK(crc_final(&crc16_x25, crc) == crc_compute(&crc16_x25, data, sizeof(data)));
+
+        crc = crc_update(&crc16_xmodem, crc_init(&crc16_xmodem), data, i);
+        crc = crc_update(&crc16_xmodem, crc, &data[i], sizeof(data) - i);
+        BENCH_CHECK(crc_final(&crc16_xmodem, crc) == crc_compute(&crc16_xmodem, data, sizeof(data)));
+    }
+}
+
+void bench_crc(uint32_t iterations)
+{
+    const CRC_Model x25_bit = {16, 0x1021, 0xFFFF, 0xFFFF, true, NULL};
+    uint8_t data[255];
+    BenchTimer timer;
+    uint32_t i = 0;
+
+    bench_crc_check();
+
+    for(i=0; i<sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i*7 + 3);
+    }
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += crc16_CCITT(0x0000, data, sizeof(data));
+    }
+    bench_stop(&timer, "crc16_CCITT (255 B)", iterations, sizeof(data));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += ngham_CRC_CCITT(data, sizeof(data));
+    }
+    bench_stop(&timer, "ngham_CRC_CCITT (255 B)", iterations, sizeof(data));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        data[0] = (uint8_t)i;
+        bench_sink += crc_compute(&crc16_x25, data, sizeof(data));
+    }
+    bench_stop(&timer, "crc_compute x25, slice-by-4 (255 B)", iterations, sizeof(data));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        data[0] = (uint8_t)i;
+        bench_sink += bench_crc16_x25_bytewise(data, sizeof(data));
+    }
+    bench_stop(&timer, "crc x25, byte table (255 B)", iterations, sizeof(data));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        data[0] = (uint8_t)i;
+        bench_sink += crc_compute(&x25_bit, data, sizeof(data));
+    }
+    bench_stop(&timer, "crc x25, bitwise (255 B)", iterations, sizeof(data));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += crc8(0x00, 0x07, data, 4);
+    }
+    bench_stop(&timer, "crc8 (4 B)", iterations, 4);
+
+    // CRC work of the 1 Hz time ISR (check, update and check of the backup)
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += bench_time_crc8_bitwise(i) + bench_time_crc8_bitwise(i + 1) + bench_time_crc8_bitwise(i + 2);
+    }
+    bench_stop(&timer, "time ISR 3x time_crc8, bitwise", iterations, 12);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += bench_time_crc8(i) + bench_time_crc8(i + 1) + bench_time_crc8(i + 2);
+    }
+    bench_stop(&timer, "time ISR 3x time_crc8, table", iterations, 12);
+}
+
+//! \} End of host_bench group
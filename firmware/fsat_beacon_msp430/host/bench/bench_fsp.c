@@ -0,0 +1,364 @@
+/*
+ * bench_fsp.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief FSP benchmarks.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup host_bench
+ * \{
+ */
+
+#include <string.h>
+
+#include <src/crc/crc.h>
+#include <src/fsp/fsp.h>
+#include <system/buffer/buffer.h>
+
+#include "bench.h"
+
+/**
+ * \brief Decodes a byte stream in chunks, counting the decoding results.
+ *
+ * \param dec is the decoder.
+ * \param data is the stream.
+ * \param len is the length of the stream.
+ * \param chunk is the length of each chunk (the bytes available at each main loop pass).
+ * \param res is the number of results of each state (incremented, indexed by the FSP_PKT_* states).
+ *
+ * \return None.
+ */
+static void bench_fsp_read(FSPDecoder *dec, const uint8_t *data, uint16_t len, uint16_t chunk, uint32_t res[5])
+{
+    uint16_t pos = 0;
+
+    while(pos < len)
+    {
+        uint16_t end = (len - pos > chunk)? pos + chunk : len;
+
+        while(pos < end)
+        {
+            uint16_t consumed = 0;
+            uint8_t state = fsp_decoder_read(dec, &data[pos], end - pos, &consumed);
+
+            BENCH_CHECK((consumed > 0) && (consumed <= end - pos));
+            BENCH_CHECK((state != FSP_PKT_NOT_READY) || (consumed == end - pos));
+
+            pos += consumed;
+            res[state]++;
+        }
+    }
+}
+
+/**
+ * \brief Encodes a FSP data packet.
+ *
+ * \param src_adr is the source address.
+ * \param dst_adr is the destination address.
+ * \param payload is the payload.
+ * \param len is the length of the payload.
+ * \param pkt is the encoded packet.
+ *
+ * \return The length of the encoded packet.
+ */
+static uint16_t bench_fsp_encode(uint8_t src_adr, uint8_t dst_adr, uint8_t *payload, uint8_t len, uint8_t *pkt)
+{
+    FSPPacket fsp;
+    uint8_t pkt_len = 0;
+
+    fsp_init(src_adr);
+    fsp_gen_data_pkt(payload, len, dst_adr, FSP_PKT_WITHOUT_ACK, &fsp);
+    fsp_encode(&fsp, pkt, &pkt_len);
+
+    return pkt_len;
+}
+
+/**
+ * \brief Checks the decoder: corrupted bytes, resynchronization, packets split between calls and the consumed bytes.
+ *
+ * \param payload is a payload with FSP_PAYLOAD_MAX_LENGTH bytes.
+ *
+ * \return None.
+ */
+static void bench_fsp_check(uint8_t *payload)
+{
+    static uint8_t stream[8*FSP_PKT_MAX_LENGTH];
+    static uint8_t frame[FSP_FRAME_MAX_LENGTH];
+    uint8_t pkt[FSP_PKT_MAX_LENGTH];
+    FSPView view;
+    uint16_t pkt_len = 0;
+    uint16_t len = 0;
+    FSPDecoder dec;
+    uint8_t state = FSP_PKT_NOT_READY;
+    uint32_t res[5];
+    uint16_t j = 0;
+    uint16_t k = 0;
+
+    pkt_len = bench_fsp_encode(FSP_ADR_OBDH, FSP_ADR_TTC, payload, 128, pkt);
+    fsp_init(FSP_ADR_TTC);
+    fsp_decoder_init(&dec, frame);
+
+    for(j=0; j<pkt_len; j++)
+    {
+        state = fsp_decoder_push(&dec, pkt[j]);
+        BENCH_CHECK(state == ((j == pkt_len-1)? FSP_PKT_READY : FSP_PKT_NOT_READY));
+    }
+    fsp_decoder_view(&dec, &view);
+    BENCH_CHECK((view.frame == frame) && (view.length == 128) && (view.src_adr == FSP_ADR_OBDH) && (view.type == FSP_PKT_TYPE_DATA));
+    BENCH_CHECK((view.offset == FSP_PKT_POS_PAYLOAD) && (memcmp(&view.frame[view.offset], payload, 128) == 0));
+    BENCH_CHECK(memcmp(frame, pkt, pkt_len) == 0);
+
+    // A corrupted header (except the SOD and the length), payload or CRC byte fails the check
+    for(j=1; j<pkt_len; j++)
+    {
+        if (j == FSP_PKT_POS_LEN)
+        {
+            continue;
+        }
+
+        pkt[j] ^= 0x10;
+        fsp_decoder_reset(&dec);
+        for(k=0; k<pkt_len; k++)
+        {
+            state = fsp_decoder_push(&dec, pkt[k]);
+        }
+        pkt[j] ^= 0x10;
+
+        BENCH_CHECK(state == FSP_PKT_INVALID);
+    }
+
+    // Longest payload (the positions of the CRC16 do not fit in 8 bits, built by hand as fsp_encode is limited to 255 bytes)
+    {
+        uint16_t crc = 0;
+
+        len = 0;
+        stream[len++] = FSP_PKT_SOD;
+        stream[len++] = FSP_ADR_EPS;
+        stream[len++] = FSP_ADR_TTC;
+        stream[len++] = FSP_PAYLOAD_MAX_LENGTH;
+        stream[len++] = FSP_PKT_TYPE_DATA;
+        memcpy(&stream[len], payload, FSP_PAYLOAD_MAX_LENGTH);
+        len += FSP_PAYLOAD_MAX_LENGTH;
+        crc = crc16_CCITT(FSP_CRC16_INITIAL_VALUE, &stream[1], len - 1);
+        stream[len++] = (uint8_t)(crc >> 8);
+        stream[len++] = (uint8_t)crc;
+    }
+    memset(res, 0, sizeof(res));
+    bench_fsp_read(&dec, stream, len, len, res);
+    fsp_decoder_view(&dec, &view);
+    BENCH_CHECK((res[FSP_PKT_READY] == 1) && (view.length == FSP_PAYLOAD_MAX_LENGTH) && (memcmp(frame, stream, len) == 0));
+
+    // Garbage, a packet, a packet to another module, a corrupted packet and a packet, read in chunks of any size
+    len = 0;
+    stream[len++] = 0x00;
+    stream[len++] = FSP_PKT_SOD;
+    stream[len++] = FSP_ADR_OBDH;
+    stream[len++] = FSP_ADR_TTC;
+    stream[len++] = 0xFF;                   // Invalid length
+    len += bench_fsp_encode(FSP_ADR_OBDH, FSP_ADR_TTC, payload, 100, &stream[len]);
+    len += bench_fsp_encode(FSP_ADR_OBDH, FSP_ADR_EPS, payload, 10, &stream[len]);
+    k = len + 20;
+    len += bench_fsp_encode(FSP_ADR_EPS, FSP_ADR_TTC, payload, 60, &stream[len]);
+    stream[k] ^= 0x01;
+    len += bench_fsp_encode(FSP_ADR_EPS, FSP_ADR_TTC, &payload[1], 1, &stream[len]);
+    fsp_init(FSP_ADR_TTC);
+
+    for(j=1; j<=len; j+=(j < 20)? 1 : 37)
+    {
+        fsp_decoder_init(&dec, frame);
+        memset(res, 0, sizeof(res));
+        bench_fsp_read(&dec, stream, len, j, res);
+        fsp_decoder_view(&dec, &view);
+
+        BENCH_CHECK((res[FSP_PKT_READY] == 2) && (res[FSP_PKT_WRONG_ADR] == 1) && (res[FSP_PKT_INVALID] == 2));
+        BENCH_CHECK((view.length == 1) && (view.frame[view.offset] == payload[1]) && (view.src_adr == FSP_ADR_EPS));
+    }
+
+    // A false SOD with an invalid length, followed by the real SOD inside its header
+    len = 0;
+    stream[len++] = FSP_PKT_SOD;
+    stream[len++] = 0x00;
+    len += bench_fsp_encode(0xFD, FSP_ADR_TTC, payload, 5, &stream[len]);
+    fsp_init(FSP_ADR_TTC);
+    fsp_decoder_init(&dec, frame);
+    memset(res, 0, sizeof(res));
+    bench_fsp_read(&dec, stream, len, len, res);
+    fsp_decoder_view(&dec, &view);
+    BENCH_CHECK((res[FSP_PKT_INVALID] == 1) && (res[FSP_PKT_READY] == 1) && (view.src_adr == 0xFD) && (view.length == 5));
+
+    // Double buffered frames: a received frame is kept while the next one is received in the other buffer
+    {
+        static uint8_t frames[2][FSP_FRAME_MAX_LENGTH];
+        uint8_t *current = NULL;
+
+        len = bench_fsp_encode(FSP_ADR_OBDH, FSP_ADR_TTC, payload, 40, stream);
+        len += bench_fsp_encode(FSP_ADR_OBDH, FSP_ADR_TTC, &payload[100], 50, &stream[len]);
+        fsp_init(FSP_ADR_TTC);
+        fsp_decoder_init(&dec, frames[0]);
+
+        for(j=0; j<len; j++)
+        {
+            if (fsp_decoder_push(&dec, stream[j]) == FSP_PKT_READY)
+            {
+                fsp_decoder_view(&dec, &view);
+                current = &view.frame[view.offset];
+                fsp_decoder_set_frame(&dec, (view.frame == frames[0])? frames[1] : frames[0]);
+
+                if (view.length == 40)
+                {
+                    k = j;      // The first packet must survive the reception of the second one
+                }
+            }
+        }
+
+        BENCH_CHECK((k < len) && (current == &frames[1][FSP_PKT_POS_PAYLOAD]));
+        BENCH_CHECK((memcmp(&frames[0][FSP_PKT_POS_PAYLOAD], payload, 40) == 0) && (memcmp(current, &payload[100], 50) == 0));
+    }
+}
+
+void bench_fsp(uint32_t iterations)
+{
+    uint8_t payload[FSP_PAYLOAD_MAX_LENGTH];
+    uint8_t pkt[FSP_PKT_MAX_LENGTH];
+    uint8_t pkt_len;
+    FSPPacket fsp;
+    FSPDecoder dec;
+    FSPView view;
+    BenchTimer timer;
+    static uint8_t frames[2][FSP_FRAME_MAX_LENGTH];
+    static FSPPacket rx_pkt;
+    static Buffer snapshot;
+    uint8_t state = FSP_PKT_NOT_READY;
+    uint32_t i = 0;
+    uint16_t j = 0;
+
+    for(j=0; j<sizeof(payload); j++)
+    {
+        payload[j] = (uint8_t)(j ^ 0x5A);
+    }
+
+    bench_fsp_check(payload);
+
+    fsp_init(FSP_ADR_OBDH);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        fsp_gen_data_pkt(payload, 128, FSP_ADR_OBDH, FSP_PKT_WITHOUT_ACK, &fsp);
+        fsp_encode(&fsp, pkt, &pkt_len);
+        bench_sink += pkt[pkt_len-1];
+    }
+    bench_stop(&timer, "fsp_gen_data_pkt+fsp_encode (128 B)", iterations, 128);
+
+    fsp_gen_data_pkt(payload, 128, FSP_ADR_TTC, FSP_PKT_WITHOUT_ACK, &fsp);
+    fsp_encode(&fsp, pkt, &pkt_len);
+    fsp_init(FSP_ADR_TTC);
+    fsp_decoder_init(&dec, frames[0]);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        for(j=0; j<pkt_len; j++)
+        {
+            state = fsp_decoder_push(&dec, pkt[j]);
+        }
+        bench_sink += state;
+    }
+    bench_stop(&timer, "fsp_decoder_push (128 B)", iterations, pkt_len);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        uint16_t consumed = 0;
+
+        bench_sink += fsp_decoder_read(&dec, pkt, pkt_len, &consumed);
+    }
+    bench_stop(&timer, "fsp_decoder_read (128 B)", iterations, pkt_len);
+
+    // Worst case latency: the last byte of a packet (the CRC16 check)
+    {
+        FSPDecoder last;
+
+        for(j=0; j<pkt_len-1; j++)
+        {
+            fsp_decoder_push(&dec, pkt[j]);
+        }
+
+        last = dec;
+        BENCH_CHECK(fsp_decoder_push(&dec, pkt[pkt_len-1]) == FSP_PKT_READY);
+
+        bench_start(&timer);
+        for(i=0; i<iterations; i++)
+        {
+            dec.pos = last.pos;
+            dec.crc = last.crc;
+            bench_sink += fsp_decoder_push(&dec, pkt[pkt_len-1]);
+        }
+        bench_stop(&timer, "fsp_decoder_push last byte (128 B)", iterations, 0);
+
+        bench_start(&timer);
+        for(i=0; i<iterations; i++)
+        {
+            bench_sink += crc16_CCITT(FSP_CRC16_INITIAL_VALUE, &dec.frame[FSP_PKT_POS_SRC_ADR], dec.frame[FSP_PKT_POS_LEN] + 4);
+        }
+        bench_stop(&timer, "crc16_CCITT at the last byte (128 B)", iterations, 0);
+    }
+
+    // Telemetry snapshot of a received data packet: copies (payload struct and buffer) against the frame swap
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        uint16_t consumed = 0;
+
+        if (fsp_decoder_read(&dec, pkt, pkt_len, &consumed) == FSP_PKT_READY)
+        {
+            fsp_decoder_view(&dec, &view);
+            memcpy(rx_pkt.payload, &view.frame[view.offset], view.length);
+            buffer_fill(&snapshot, rx_pkt.payload, view.length);
+        }
+        bench_sink += snapshot.data[i & 0x7F];
+    }
+    bench_stop(&timer, "fsp rx to snapshot, copies (128 B)", iterations, pkt_len);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        uint16_t consumed = 0;
+        uint8_t *current = frames[0];
+
+        if (fsp_decoder_read(&dec, pkt, pkt_len, &consumed) == FSP_PKT_READY)
+        {
+            fsp_decoder_view(&dec, &view);
+            current = &view.frame[view.offset];
+            fsp_decoder_set_frame(&dec, (view.frame == frames[0])? frames[1] : frames[0]);
+        }
+        bench_sink += current[i & 0x7F];
+    }
+    bench_stop(&timer, "fsp rx to snapshot, frame swap (128 B)", iterations, pkt_len);
+}
+
+//! \} End of host_bench group
@@ -0,0 +1,253 @@
+/*
+ * bench_kiss.c
+ *
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ *
+ * This file is part of FloripaSat-TTC.
+ *
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief KISS framing benchmarks.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \addtogroup host_bench
+ * \{
+ */
+
+#include <string.h>
+
+#include <src/kiss/kiss.h>
+
+#include "bench.h"
+
+/**
+ * \brief Pushes a byte stream into a KISS decoder.
+ *
+ * \param dec is the decoder.
+ * \param data is the stream.
+ * \param len is the length of the stream.
+ * \param ok is the number of received frames (incremented).
+ * \param fail is the number of dropped frames (incremented).
+ *
+ * \return None.
+ */
+static void bench_kiss_push(KISS_Decoder *dec, const uint8_t *data, uint16_t len, uint32_t *ok, uint32_t *fail)
+{
+    uint16_t i = 0;
+
+    for(i=0; i<len; i++)
+    {
+        uint8_t state = kiss_decode(dec, data[i]);
+
+        if (state == KISS_DECODE_OK)
+        {
+            (*ok)++;
+        }
+        else if (state == KISS_DECODE_FAIL)
+        {
+            (*fail)++;
+        }
+    }
+}
+
+/**
+ * \brief Checks the decoding of encoded frames, the resynchronization after invalid ones and the buffer limit.
+ *
+ * \return None.
+ */
+static void bench_kiss_check()
+{
+    static uint8_t data[512];
+    static uint8_t frame[KISS_FRAME_MAX_LEN(512)];
+    static uint8_t rx[512];
+    KISS_Decoder dec;
+    uint16_t frame_len = 0;
+    uint32_t ok = 0;
+    uint32_t fail = 0;
+    uint16_t i = 0;
+
+    // A quarter of the bytes are FEND and another quarter FESC
+    for(i=0; i<sizeof(data); i++)
+    {
+        data[i] = ((i % 4) == 0)? KISS_FEND : (((i % 4) == 1)? KISS_FESC : (uint8_t)((i*13 + 5) & 0x7F));
+    }
+
+    frame_len = kiss_encode(KISS_TYPE(3, KISS_CMD_DATA), data, sizeof(data), frame);
+    BENCH_CHECK(frame_len == sizeof(data) + sizeof(data)/2 + 3);
+
+    kiss_decoder_init(&dec, rx, sizeof(rx));
+    for(i=0; i<frame_len; i++)
+    {
+        uint8_t state = kiss_decode(&dec, frame[i]);
+
+        BENCH_CHECK(state == ((i == frame_len-1)? KISS_DECODE_OK : KISS_DECODE_PREFAIL));
+    }
+    BENCH_CHECK((dec.type == 0x30) && (dec.len == sizeof(data)) && (memcmp(rx, data, sizeof(data)) == 0));
+
+    // The type byte of port 12 is a FEND
+    frame_len = kiss_encode(KISS_TYPE(12, KISS_CMD_DATA), data, 8, frame);
+    BENCH_CHECK((frame[1] == KISS_FESC) && (frame[2] == KISS_TFEND));
+    ok = 0;
+    bench_kiss_push(&dec, frame, frame_len, &ok, &fail);
+    BENCH_CHECK((ok == 1) && (fail == 0) && (dec.type == KISS_FEND) && (dec.len == 8));
+
+    // Garbage before the first FEND, empty frames and frames sharing their FENDs
+    {
+        const uint8_t stream[] = {0x11, KISS_FESC, 0x22, KISS_FEND, KISS_FEND, KISS_FEND, 0x00, 0x41, KISS_FEND, 0x10, 0x42, 0x43, KISS_FEND};
+
+        kiss_decoder_init(&dec, rx, sizeof(rx));
+        ok = 0;
+        fail = 0;
+        bench_kiss_push(&dec, stream, sizeof(stream), &ok, &fail);
+        BENCH_CHECK((ok == 2) && (fail == 0) && (dec.type == 0x10) && (dec.len == 2) && (rx[0] == 0x42));
+    }
+
+    // An invalid escape sequence and an aborted one drop their frames only
+    {
+        const uint8_t stream[] = {KISS_FEND, 0x00, 0x41, KISS_FESC, 0x41, 0x42, KISS_FEND, 0x00, KISS_FESC, KISS_FEND,
+                                  0x00, KISS_FESC, KISS_TFESC, KISS_FEND};
+
+        kiss_decoder_init(&dec, rx, sizeof(rx));
+        ok = 0;
+        fail = 0;
+        bench_kiss_push(&dec, stream, sizeof(stream), &ok, &fail);
+        BENCH_CHECK((ok == 1) && (fail == 2) && (dec.len == 1) && (rx[0] == KISS_FESC));
+    }
+
+    // Frames longer than the buffer are dropped
+    for(i=15; i<=17; i++)
+    {
+        kiss_decoder_init(&dec, rx, 16);
+        ok = 0;
+        fail = 0;
+        frame_len = kiss_encode(KISS_TYPE(0, KISS_CMD_DATA), data, i, frame);
+        bench_kiss_push(&dec, frame, frame_len, &ok, &fail);
+        BENCH_CHECK((i <= 16)? ((ok == 1) && (dec.len == i)) : (fail == 1));
+    }
+}
+
+/**
+ * \brief Checks the double buffered receiver with frames longer than a radio read (90 bytes).
+ *
+ * \return None.
+ */
+static void bench_kiss_receiver_check()
+{
+    static uint8_t buffer[2][256];
+    static uint8_t data[220];
+    static uint8_t frame[KISS_FRAME_MAX_LEN(220)];
+    static uint8_t rx[220];
+    KISS_Receiver receiver;
+    uint16_t frame_len = 0;
+    uint16_t rx_len = 0;
+    uint16_t n = 0;
+    uint16_t i = 0;
+
+    for(i=0; i<sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i*29 + 1);
+    }
+
+    kiss_receiver_init(&receiver, KISS_TYPE(0, KISS_CMD_DATA), buffer[0], buffer[1], sizeof(buffer[0]));
+
+    // Two frames in a row: the second one is dropped, as the first one is not read yet
+    frame_len = kiss_encode(KISS_TYPE(0, KISS_CMD_DATA), data, sizeof(data), frame);
+    for(n=0; n<2; n++)
+    {
+        for(i=0; i<frame_len; i++)
+        {
+            kiss_receiver_push(&receiver, frame[i]);
+        }
+    }
+
+    // The frame is read in 90 bytes blocks, and released after the last one
+    while(kiss_receiver_available(&receiver) > 0)
+    {
+        uint16_t available = kiss_receiver_available(&receiver);
+
+        n = kiss_receiver_read(&receiver, &rx[rx_len], 90);
+        BENCH_CHECK(n == ((available > 90)? 90 : available));
+        rx_len += n;
+    }
+    BENCH_CHECK((rx_len == sizeof(data)) && (memcmp(rx, data, sizeof(data)) == 0));
+    BENCH_CHECK(kiss_receiver_read(&receiver, rx, 90) == 0);
+
+    // Frames of other ports are ignored, and the next frame goes to the released buffer
+    frame_len = kiss_encode(KISS_TYPE(1, KISS_CMD_DATA), data, 100, frame);
+    for(i=0; i<frame_len; i++)
+    {
+        kiss_receiver_push(&receiver, frame[i]);
+    }
+    BENCH_CHECK(kiss_receiver_available(&receiver) == 0);
+
+    frame_len = kiss_encode(KISS_TYPE(0, KISS_CMD_DATA), &data[1], 91, frame);
+    for(i=0; i<frame_len; i++)
+    {
+        kiss_receiver_push(&receiver, frame[i]);
+    }
+    BENCH_CHECK((kiss_receiver_read(&receiver, rx, 90) == 90) && (kiss_receiver_available(&receiver) == 1));
+    BENCH_CHECK((kiss_receiver_read(&receiver, &rx[90], 90) == 1) && (memcmp(rx, &data[1], 91) == 0));
+    BENCH_CHECK(kiss_receiver_available(&receiver) == 0);
+}
+
+void bench_kiss(uint32_t iterations)
+{
+    static uint8_t data[255];
+    static uint8_t frame[KISS_FRAME_MAX_LEN(255)];
+    static uint8_t rx[255];
+    KISS_Decoder dec;
+    BenchTimer timer;
+    uint16_t frame_len = 0;
+    uint32_t ok = 0;
+    uint32_t fail = 0;
+    uint32_t i = 0;
+
+    bench_kiss_check();
+    bench_kiss_receiver_check();
+
+    for(i=0; i<sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i*7 + 3);
+    }
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        data[0] = (uint8_t)i;
+        frame_len = kiss_encode(KISS_TYPE(0, KISS_CMD_DATA), data, sizeof(data), frame);
+        bench_sink += frame_len;
+    }
+    bench_stop(&timer, "kiss_encode (255 B)", iterations, sizeof(data));
+
+    kiss_decoder_init(&dec, rx, sizeof(rx));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_kiss_push(&dec, frame, frame_len, &ok, &fail);
+    }
+    bench_stop(&timer, "kiss_decode (255 B)", iterations, sizeof(data));
+
+    BENCH_CHECK((ok == iterations) && (fail == 0));
+}
+
+//! \} End of host_bench group
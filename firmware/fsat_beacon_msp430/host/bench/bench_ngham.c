@@ -0,0 +1,810 @@
+/*
+ * bench_ngham.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief NGHam benchmarks.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup host_bench
+ * \{
+ */
+
+#include <string.h>
+
+#include <src/ngham/ngham.h>
+#include <src/ngham/ngham_sync.h>
+
+#include "bench.h"
+
+/**
+ * \brief Checks if a Reed Solomon codeword is valid (all syndromes equal to zero).
+ * 
+ * \param rs is the control block of the code.
+ * \param codeword is the codeword (data followed by parity).
+ * 
+ * \return 1 if the codeword is valid, 0 otherwise.
+ */
+static int bench_rs_codeword_valid(const RS *rs, uint8_t *codeword)
+{
+    uint16_t i = 0;
+    uint16_t j = 0;
+
+    for(i=0; i<rs->nroots; i++)
+    {
+        uint8_t s = 0;
+        uint16_t root = ((rs->fcr + i)*rs->prim) % rs->nn;
+
+        for(j=0; j<(rs->nn - rs->pad); j++)
+        {
+            s = codeword[j] ^ ((s == 0)? 0 : rs->alpha_to[(rs->index_of[s] + root) % rs->nn]);
+        }
+
+        if (s != 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static void bench_rs_encode(uint32_t iterations)
+{
+    uint8_t codeword[NGH_MAX_CODEWORD_SIZE];
+    BenchTimer timer;
+    uint32_t i = 0;
+    uint8_t size_nr = 0;
+
+    for(size_nr=0; size_nr<NGH_SIZES; size_nr++)
+    {
+        for(i=0; i<NGH_PL_SIZE_FULL[size_nr]; i++)
+        {
+            codeword[i] = (uint8_t)(i*17 + size_nr);
+        }
+
+        encode_rs_char(&rs_cb[size_nr], codeword, &codeword[NGH_PL_SIZE_FULL[size_nr]]);
+
+        BENCH_CHECK(bench_rs_codeword_valid(&rs_cb[size_nr], codeword));
+
+        codeword[0] ^= 0x01;
+        BENCH_CHECK(!bench_rs_codeword_valid(&rs_cb[size_nr], codeword));
+    }
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        encode_rs_char(&rs_cb[1], codeword, &codeword[NGH_PL_SIZE_FULL[1]]);
+        bench_sink += codeword[NGH_PL_PAR_SIZE[1]-1];
+    }
+    bench_stop(&timer, "encode_rs_char (63 B, 16 roots)", iterations, NGH_PL_SIZE_FULL[1]);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        encode_rs_char(&rs_cb[6], codeword, &codeword[NGH_PL_SIZE_FULL[6]]);
+        bench_sink += codeword[NGH_PL_PAR_SIZE[6]-1];
+    }
+    bench_stop(&timer, "encode_rs_char (223 B, 32 roots)", iterations, NGH_PL_SIZE_FULL[6]);
+}
+
+/**
+ * \brief Corrupts symbols of a codeword at evenly spread positions.
+ * 
+ * \param codeword is the codeword to corrupt.
+ * \param len is the length of the codeword.
+ * \param errors is the number of symbols to corrupt.
+ * 
+ * \return None.
+ */
+static void bench_rs_corrupt(uint8_t *codeword, uint16_t len, uint16_t errors)
+{
+    uint16_t i = 0;
+
+    for(i=0; i<errors; i++)
+    {
+        codeword[(i*len)/errors] ^= (uint8_t)(0xA5 + i);
+    }
+}
+
+static void bench_rs_decode(uint32_t iterations)
+{
+    uint8_t ref[NGH_MAX_CODEWORD_SIZE];
+    uint8_t codeword[NGH_MAX_CODEWORD_SIZE];
+    BenchTimer timer;
+    uint32_t i = 0;
+    uint8_t size_nr = 0;
+
+    for(size_nr=0; size_nr<NGH_SIZES; size_nr++)
+    {
+        uint16_t len = NGH_PL_PAR_SIZE[size_nr];
+        uint16_t t = NGH_PAR_SIZE[size_nr]/2;
+
+        for(i=0; i<NGH_PL_SIZE_FULL[size_nr]; i++)
+        {
+            ref[i] = (uint8_t)(i*29 + size_nr);
+        }
+        encode_rs_char(&rs_cb[size_nr], ref, &ref[NGH_PL_SIZE_FULL[size_nr]]);
+
+        memcpy(codeword, ref, len);
+        BENCH_CHECK(decode_rs_char(&rs_cb[size_nr], codeword, NULL, 0) == 0);
+
+        bench_rs_corrupt(codeword, len, t);
+        BENCH_CHECK(decode_rs_char(&rs_cb[size_nr], codeword, NULL, 0) == t);
+        BENCH_CHECK(memcmp(codeword, ref, len) == 0);
+
+        // nroots erasures (positions include the shortening pad)
+        int16_t eras_pos[FEC_MAX_NROOTS];
+        uint16_t no_eras = 2*t;
+
+        for(i=0; i<no_eras; i++)
+        {
+            eras_pos[i] = rs_cb[size_nr].pad + (i*len)/no_eras;
+        }
+
+        bench_rs_corrupt(codeword, len, no_eras);
+        BENCH_CHECK(decode_rs_char(&rs_cb[size_nr], codeword, eras_pos, no_eras) == no_eras);
+        BENCH_CHECK(memcmp(codeword, ref, len) == 0);
+
+        // nroots-4 erasures and two unflagged errors (eras_pos was overwritten with the corrected positions)
+        for(i=0; i<no_eras-4; i++)
+        {
+            eras_pos[i] = rs_cb[size_nr].pad + (i*len)/no_eras;
+        }
+
+        bench_rs_corrupt(codeword, len, no_eras);
+        for(i=no_eras-4; i<no_eras; i++)
+        {
+            codeword[(i*len)/no_eras] ^= (uint8_t)(0xA5 + i);
+        }
+        codeword[len-1] ^= 0x5A;
+        codeword[len-2] ^= 0x3C;
+        BENCH_CHECK(decode_rs_char(&rs_cb[size_nr], codeword, eras_pos, no_eras-4) == no_eras-2);
+        BENCH_CHECK(memcmp(codeword, ref, len) == 0);
+    }
+
+    // 223 B payload codeword with 32 roots
+    for(i=0; i<NGH_PL_SIZE_FULL[6]; i++)
+    {
+        ref[i] = (uint8_t)(i*29 + 6);
+    }
+    encode_rs_char(&rs_cb[6], ref, &ref[NGH_PL_SIZE_FULL[6]]);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        memcpy(codeword, ref, NGH_PL_PAR_SIZE[6]);
+        bench_sink += decode_rs_char(&rs_cb[6], codeword, NULL, 0);
+    }
+    bench_stop(&timer, "decode_rs_char (255 B, no errors)", iterations, NGH_PL_PAR_SIZE[6]);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        memcpy(codeword, ref, NGH_PL_PAR_SIZE[6]);
+        bench_rs_corrupt(codeword, NGH_PL_PAR_SIZE[6], 16);
+        bench_sink += decode_rs_char(&rs_cb[6], codeword, NULL, 0);
+    }
+    bench_stop(&timer, "decode_rs_char (255 B, 16 errors)", iterations, NGH_PL_PAR_SIZE[6]);
+}
+
+/**
+ * \brief Feeds an encoded NGHam packet (without preamble and sync. word) to the decoder.
+ * 
+ * \param pkt is the encoded packet (as returned by ngham_encode).
+ * \param pkt_len is the length of the encoded packet.
+ * \param msg is the array to store the decoded payload.
+ * \param msg_len is the length of the decoded payload.
+ * \param eras_pos is the positions in pkt to flag as erasures, in ascending order (or NULL).
+ * \param no_eras is the number of positions in eras_pos.
+ * 
+ * \return The last decoder state.
+ */
+static uint8_t bench_ngham_decode_pkt(uint8_t *pkt, uint16_t pkt_len, uint8_t *msg, uint8_t *msg_len, const uint16_t *eras_pos, uint16_t no_eras)
+{
+    uint8_t state = PKT_CONDITION_PREFAIL;
+    uint16_t i = 0;
+    uint16_t e = 0;
+
+    for(i=NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE; i<pkt_len; i++)
+    {
+        if ((e < no_eras) && (eras_pos[e] == i))
+        {
+            ngham_mark_erasure();
+            e++;
+        }
+
+        state = ngham_decode(pkt[i], msg, msg_len);
+        if (state != PKT_CONDITION_PREFAIL)
+        {
+            break;
+        }
+    }
+
+    return state;
+}
+
+static void bench_ngham_size_tag(uint32_t iterations)
+{
+    NGHamDecoder dec;
+    uint8_t msg[NGHAM_PL_MAX];
+    uint8_t msg_len = 0;
+    BenchTimer timer;
+    uint32_t i = 0;
+    uint8_t size_nr = 0;
+
+    for(i=0; i<256; i++)
+    {
+        BENCH_CHECK(ngham_popcount[i] == __builtin_popcount(i));
+    }
+
+    // A tag with NGH_SIZE_TAG_MAX_ERROR wrong bits is still detected, one more bit is rejected
+    for(size_nr=0; size_nr<NGH_SIZES; size_nr++)
+    {
+        uint32_t tag = NGH_SIZE_TAG[size_nr] ^ 0x810204UL ^ 0x000810UL;    // 6 bits
+
+        ngham_decoder_init(&dec);
+        BENCH_CHECK(ngham_decoder_push(&dec, (tag >> 16) & 0xFF, msg, &msg_len) == PKT_CONDITION_PREFAIL);
+        BENCH_CHECK(ngham_decoder_push(&dec, (tag >> 8) & 0xFF, msg, &msg_len) == PKT_CONDITION_PREFAIL);
+        BENCH_CHECK(ngham_decoder_push(&dec, tag & 0xFF, msg, &msg_len) == PKT_CONDITION_PREFAIL);
+        BENCH_CHECK((dec.state == NGH_STATE_SIZE_KNOWN) && (dec.size_nr == size_nr));
+
+        ngham_decoder_init(&dec);
+        tag ^= 0x400000UL;  // 7 bits
+        ngham_decoder_push(&dec, (tag >> 16) & 0xFF, msg, &msg_len);
+        ngham_decoder_push(&dec, (tag >> 8) & 0xFF, msg, &msg_len);
+        ngham_decoder_push(&dec, tag & 0xFF, msg, &msg_len);
+        BENCH_CHECK(dec.state == NGH_STATE_SIZE_TAG);
+    }
+
+    // Worst case: a rejected tag is compared against all sizes
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        ngham_decoder_push(&dec, 0x00, msg, &msg_len);
+        ngham_decoder_push(&dec, 0x00, msg, &msg_len);
+        bench_sink += ngham_decoder_push(&dec, 0x00, msg, &msg_len);
+    }
+    bench_stop(&timer, "ngham_decode (rejected size tag)", iterations, NGH_SIZE_TAG_SIZE);
+}
+
+/**
+ * \brief Feeds an encoded NGHam packet (without preamble and sync. word) to a decoder context, in blocks.
+ * 
+ * Blocks end before each erasure, as in beacon_process_radio_pkt.
+ * 
+ * \param dec is the decoder context.
+ * \param pkt is the encoded packet (as returned by ngham_encode).
+ * \param pkt_len is the length of the encoded packet.
+ * \param block is the maximum block length.
+ * \param eras_pos is the positions in pkt to flag as erasures, in ascending order (or NULL).
+ * \param no_eras is the number of positions in eras_pos.
+ * \param msg is the array to store the decoded payload.
+ * \param msg_len is the length of the decoded payload.
+ * 
+ * \return The last decoder state.
+ */
+static uint8_t bench_ngham_decode_blocks(NGHamDecoder *dec, uint8_t *pkt, uint16_t pkt_len, uint16_t block, const uint16_t *eras_pos, uint16_t no_eras, uint8_t *msg, uint8_t *msg_len)
+{
+    uint8_t state = PKT_CONDITION_PREFAIL;
+    uint16_t consumed = 0;
+    uint16_t i = 0;
+    uint16_t e = 0;
+
+    for(i=NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE; i<pkt_len; i+=consumed)
+    {
+        uint16_t block_len = (pkt_len - i < block)? pkt_len - i : block;
+
+        if ((e < no_eras) && (eras_pos[e] == i))
+        {
+            ngham_decoder_mark_erasure(dec);
+            e++;
+        }
+
+        if ((e < no_eras) && (eras_pos[e] - i < block_len))
+        {
+            block_len = eras_pos[e] - i;
+        }
+
+        state = ngham_decode_block(dec, &pkt[i], block_len, &consumed, msg, msg_len);
+        if (state != PKT_CONDITION_PREFAIL)
+        {
+            break;
+        }
+    }
+
+    return state;
+}
+
+/**
+ * \brief Checks two decoder contexts fed with interleaved bytes of two different packets.
+ * 
+ * \return None.
+ */
+static void bench_ngham_decoder_contexts()
+{
+    NGHamDecoder dec[2];
+    NGHam_TX_Packet tx_pkt;
+    uint8_t payload[2][NGHAM_PL_MAX];
+    uint8_t pkt[2][NGH_MAX_TOT_SIZE];
+    uint16_t pkt_len[2];
+    uint8_t msg[NGHAM_PL_MAX];
+    uint8_t msg_len = 0;
+    uint8_t done[2] = {0, 0};
+    uint16_t i = 0;
+    uint8_t n = 0;
+
+    for(n=0; n<2; n++)
+    {
+        for(i=0; i<NGHAM_PL_MAX; i++)
+        {
+            payload[n][i] = (uint8_t)(i*7 + n*101);
+        }
+
+        ngham_tx_pkt_gen(&tx_pkt, payload[n], (n == 0)? 28 : 200);
+        ngham_encode(&tx_pkt, pkt[n], &pkt_len[n]);
+        ngham_decoder_init(&dec[n]);
+    }
+
+    for(i=NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE; i<pkt_len[1]; i++)
+    {
+        for(n=0; n<2; n++)
+        {
+            if ((i < pkt_len[n]) && !done[n])
+            {
+                uint8_t state = ngham_decoder_push(&dec[n], pkt[n][i], msg, &msg_len);
+
+                if (state != PKT_CONDITION_PREFAIL)
+                {
+                    BENCH_CHECK(state == PKT_CONDITION_OK);
+                    BENCH_CHECK((msg_len == ((n == 0)? 28 : 200)) && (memcmp(msg, payload[n], msg_len) == 0));
+                    done[n] = 1;
+                }
+            }
+        }
+    }
+
+    BENCH_CHECK(done[0] && done[1]);
+}
+
+/**
+ * \brief Writes bytes into a bit stream (MSB first) at any bit position.
+ * 
+ * \param stream is the bit stream.
+ * \param bit_pos is the bit position to write, updated to the end of the written bits.
+ * \param data is the bytes to write.
+ * \param len is the number of bytes to write.
+ * 
+ * \return None.
+ */
+static void bench_bits_put(uint8_t *stream, uint32_t *bit_pos, const uint8_t *data, uint16_t len)
+{
+    uint16_t i = 0;
+    int8_t b = 0;
+
+    for(i=0; i<len; i++)
+    {
+        for(b=7; b>=0; b--, (*bit_pos)++)
+        {
+            if ((data[i] >> b) & 0x01)
+            {
+                stream[*bit_pos >> 3] |= 0x80 >> (*bit_pos & 0x07);
+            }
+            else
+            {
+                stream[*bit_pos >> 3] &= ~(0x80 >> (*bit_pos & 0x07));
+            }
+        }
+    }
+}
+
+/**
+ * \brief Builds a bit stream of noise with NGHam packets at every bit offset.
+ * 
+ * The payload of the packet n is filled with n, and its sync. word has n%4 wrong bits.
+ * 
+ * \param stream is the bit stream.
+ * \param len is the length of the stream in bytes.
+ * \param four_level selects the four-level preamble and sync. word.
+ * 
+ * \return The number of packets in the stream.
+ */
+static uint16_t bench_ngham_stream(uint8_t *stream, uint32_t len, uint8_t four_level)
+{
+    NGHam_TX_Packet tx_pkt;
+    uint8_t payload[NGHAM_PL_MAX];
+    uint8_t pkt[NGH_MAX_TOT_SIZE];
+    uint8_t frame[NGH_MAX_TOT_SIZE];
+    uint16_t pkt_len = 0;
+    uint16_t frame_len = 0;
+    uint32_t seed = 12345;
+    uint32_t bit_pos = 0;
+    uint16_t n = 0;
+    uint32_t i = 0;
+
+    for(i=0; i<len; i++)
+    {
+        seed = seed*1103515245 + 12345;
+        stream[i] = (uint8_t)(seed >> 16);
+    }
+
+    for(n=0; bit_pos/8 + NGH_MAX_TOT_SIZE + 64 < len; n++)
+    {
+        uint8_t pl_len = NGH_PL_SIZE[n % NGH_SIZES];
+
+        memset(payload, n, pl_len);
+        ngham_tx_pkt_gen(&tx_pkt, payload, pl_len);
+        ngham_encode(&tx_pkt, pkt, &pkt_len);
+
+        // The encoder output is the two-level framing: preamble, sync. word, size tag and codeword
+        frame_len = 0;
+        for(i=0; i<(four_level? NGH_PREAMBLE_SIZE_FOUR_LEVEL : NGH_PREAMBLE_SIZE); i++)
+        {
+            frame[frame_len++] = four_level? NGH_PREAMBLE_FOUR_LEVEL : NGH_PREAMBLE;
+        }
+        for(i=0; i<(four_level? NGH_SYNC_SIZE_FOUR_LEVEL : NGH_SYNC_SIZE); i++)
+        {
+            frame[frame_len++] = four_level? NGH_SYNC_FOUR_LEVEL[i] : NGH_SYNC[i];
+        }
+        for(i=0; i<(n % 4); i++)
+        {
+            frame[frame_len - 1 - 3*i] ^= 0x10;     // Wrong bits in the sync. word
+        }
+        for(i=NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE; i<pkt_len; i++)
+        {
+            frame[frame_len++] = pkt[i];
+        }
+
+        bit_pos += 8*(n % 5) + (n % 8) + 13;    // Noise between packets, at every bit offset
+        bench_bits_put(stream, &bit_pos, frame, frame_len);
+    }
+
+    return n;
+}
+
+/**
+ * \brief Decodes a bit stream built by bench_ngham_stream, checking every packet.
+ * 
+ * \param stream is the bit stream.
+ * \param len is the length of the stream in bytes.
+ * \param four_level selects the four-level sync. word.
+ * \param check enables the payload checks.
+ * 
+ * \return The number of decoded packets.
+ */
+static uint16_t bench_ngham_sync_decode(uint8_t *stream, uint32_t len, uint8_t four_level, uint8_t check)
+{
+    NGHamDecoder dec;
+    NGHamSync sync;
+    uint8_t msg[NGHAM_PL_MAX];
+    uint8_t msg_len = 0;
+    uint32_t pos = 0;
+    uint16_t n = 0;
+    uint16_t i = 0;
+
+    ngham_sync_init(&sync, &dec, four_level, NGH_SYNC_MAX_ERROR);
+
+    while(pos < len)
+    {
+        uint16_t consumed = 0;
+        uint16_t block = (len - pos > 1024)? 1024 : len - pos;
+
+        if (ngham_sync_push(&sync, &stream[pos], block, &consumed, msg, &msg_len) == PKT_CONDITION_OK)
+        {
+            if (check)
+            {
+                BENCH_CHECK(msg_len == NGH_PL_SIZE[n % NGH_SIZES]);
+                for(i=0; i<msg_len; i++)
+                {
+                    BENCH_CHECK(msg[i] == (uint8_t)n);
+                }
+            }
+
+            n++;
+        }
+
+        pos += consumed;
+    }
+
+    return n;
+}
+
+/**
+ * \brief Checks the packets right after a false sync. word, whose sync. word overlaps the rejected size tag.
+ * 
+ * The stream is pushed byte by byte, so the rejected tag bytes are searched again across the calls.
+ * 
+ * \return None.
+ */
+static void bench_ngham_sync_false_lock()
+{
+    NGHam_TX_Packet tx_pkt;
+    NGHamDecoder dec;
+    NGHamSync sync;
+    uint8_t payload[NGHAM_PL_MAX];
+    uint8_t pkt[NGH_MAX_TOT_SIZE];
+    uint8_t stream[NGH_MAX_TOT_SIZE + 16];
+    uint8_t msg[NGHAM_PL_MAX];
+    uint8_t msg_len = 0;
+    uint16_t pkt_len = 0;
+    uint8_t gap = 0;
+    uint8_t shift = 0;
+    uint16_t i = 0;
+
+    memset(payload, 0x5A, NGH_PL_SIZE[0]);
+    ngham_tx_pkt_gen(&tx_pkt, payload, NGH_PL_SIZE[0]);
+    ngham_encode(&tx_pkt, pkt, &pkt_len);
+
+    // False sync. word, 0 to 2 bytes of the rejected tag, and the packet sync. word
+    for(gap=0; gap<NGH_SIZE_TAG_SIZE; gap++)
+    {
+        for(shift=0; shift<8; shift++)
+        {
+            uint32_t bit_pos = 8 + shift;
+            uint16_t ok = 0;
+
+            memset(stream, NGH_PREAMBLE, sizeof(stream));
+            bench_bits_put(stream, &bit_pos, NGH_SYNC, NGH_SYNC_SIZE);
+            bit_pos += 8*gap;
+            bench_bits_put(stream, &bit_pos, &pkt[NGH_PREAMBLE_SIZE], pkt_len - NGH_PREAMBLE_SIZE);
+
+            ngham_sync_init(&sync, &dec, 0, 0);
+
+            for(i=0; i<sizeof(stream); i++)
+            {
+                uint16_t consumed = 0;
+
+                if (ngham_sync_push(&sync, &stream[i], 1, &consumed, msg, &msg_len) == PKT_CONDITION_OK)
+                {
+                    ok += (msg_len == NGH_PL_SIZE[0]) && (memcmp(msg, payload, msg_len) == 0);
+                }
+            }
+
+            BENCH_CHECK(ok == 1);
+        }
+    }
+}
+
+static void bench_ngham_sync(uint32_t iterations)
+{
+    static uint8_t stream[64*1024];
+    BenchTimer timer;
+    uint16_t n = 0;
+    uint32_t i = 0;
+
+    bench_ngham_sync_false_lock();
+
+    n = bench_ngham_stream(stream, sizeof(stream), 1);
+    BENCH_CHECK(bench_ngham_sync_decode(stream, sizeof(stream), 1, 1) == n);
+
+    n = bench_ngham_stream(stream, sizeof(stream), 0);
+    BENCH_CHECK(bench_ngham_sync_decode(stream, sizeof(stream), 0, 1) == n);
+
+    iterations = (iterations + 99)/100;
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += bench_ngham_sync_decode(stream, sizeof(stream), 0, 0);
+    }
+    bench_stop(&timer, "ngham_sync_push (64 KiB stream)", iterations, sizeof(stream));
+
+    // Noise only: the throughput of the search itself
+    memset(stream, NGH_PREAMBLE, sizeof(stream));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += bench_ngham_sync_decode(stream, sizeof(stream), 0, 0);
+    }
+    bench_stop(&timer, "ngham_sync_push (64 KiB preamble)", iterations, sizeof(stream));
+}
+
+/**
+ * \brief Checks and times the in place encoding of a packet builder against ngham_encode.
+ * 
+ * \param iterations is the number of timed encodings.
+ * \param payload is the payload (NGHAM_PL_MAX bytes).
+ * 
+ * \return None.
+ */
+static void bench_ngham_encode_frame(uint32_t iterations, const uint8_t *payload)
+{
+    const uint8_t lens[] = {1, 28, 29, 60, 93, 124, 188, NGHAM_PL_MAX};
+    NGHam_TX_Packet tx_pkt;
+    uint8_t pkt[NGH_MAX_TOT_SIZE];
+    uint16_t pkt_len;
+    uint8_t frame[NGH_MAX_FRAME_SIZE];
+    PacketBuilder pb;
+    BenchTimer timer;
+    uint32_t i = 0;
+
+    // The same packet as ngham_encode, without preamble and sync. word, and starting at the beginning of the buffer
+    for(i=0; i<sizeof(lens); i++)
+    {
+        ngham_tx_pkt_gen(&tx_pkt, (uint8_t *)payload, lens[i]);
+        ngham_encode(&tx_pkt, pkt, &pkt_len);
+
+        packet_builder_init(&pb, frame, sizeof(frame), NGH_FRAME_HEADROOM);
+        BENCH_CHECK(packet_builder_append(&pb, payload, lens[i]));
+        BENCH_CHECK(ngham_encode_frame(&pb, 0));
+        BENCH_CHECK(packet_builder_data(&pb) == frame);
+        BENCH_CHECK((packet_builder_len(&pb) == pkt_len - NGH_SYNC_HEADROOM) && (memcmp(frame, &pkt[NGH_SYNC_HEADROOM], pkt_len - NGH_SYNC_HEADROOM) == 0));
+    }
+
+    // Not enough room around the payload, or no payload: the frame is not changed
+    packet_builder_init(&pb, frame, sizeof(frame), NGH_FRAME_HEADROOM - 1);
+    packet_builder_append(&pb, payload, 60);
+    BENCH_CHECK(!ngham_encode_frame(&pb, 0) && (packet_builder_len(&pb) == 60));
+
+    packet_builder_init(&pb, frame, NGH_FRAME_HEADROOM + 60 + 16, NGH_FRAME_HEADROOM);
+    packet_builder_append(&pb, payload, 60);
+    BENCH_CHECK(!ngham_encode_frame(&pb, 0) && (packet_builder_len(&pb) == 60));
+
+    packet_builder_init(&pb, frame, sizeof(frame), NGH_FRAME_HEADROOM);
+    BENCH_CHECK(!ngham_encode_frame(&pb, 0));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        packet_builder_init(&pb, frame, sizeof(frame), NGH_FRAME_HEADROOM);
+        packet_builder_append(&pb, payload, NGHAM_PL_MAX);
+        ngham_encode_frame(&pb, 0);
+        bench_sink += frame[packet_builder_len(&pb)-1];
+    }
+    bench_stop(&timer, "packet_builder+ngham_encode_frame (220 B)", iterations, NGHAM_PL_MAX);
+}
+
+void bench_ngham(uint32_t iterations)
+{
+    NGHam_TX_Packet tx_pkt;
+    uint8_t payload[NGHAM_PL_MAX];
+    uint8_t pkt[NGH_MAX_TOT_SIZE];
+    uint16_t pkt_len;
+    BenchTimer timer;
+    uint32_t i = 0;
+
+    for(i=0; i<sizeof(payload); i++)
+    {
+        payload[i] = (uint8_t)(i*31 + 5);
+    }
+
+    ngham_init();
+
+    bench_rs_encode(iterations);
+    bench_rs_decode(iterations);
+    bench_ngham_size_tag(iterations);
+    bench_ngham_decoder_contexts();
+    bench_ngham_sync(iterations);
+
+    ngham_tx_pkt_gen(&tx_pkt, payload, 60);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        ngham_encode(&tx_pkt, pkt, &pkt_len);
+        bench_sink += pkt[pkt_len-1];
+    }
+    bench_stop(&timer, "ngham_encode (60 B)", iterations, 60);
+
+    ngham_tx_pkt_gen(&tx_pkt, payload, NGHAM_PL_MAX);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        ngham_encode(&tx_pkt, pkt, &pkt_len);
+        bench_sink += pkt[pkt_len-1];
+    }
+    bench_stop(&timer, "ngham_encode (220 B)", iterations, NGHAM_PL_MAX);
+
+    bench_ngham_encode_frame(iterations, payload);
+
+    uint8_t msg[NGHAM_PL_MAX];
+    uint8_t msg_len = 0;
+
+    uint8_t ref[NGH_MAX_TOT_SIZE];
+    uint16_t eras_pos[FEC_MAX_NROOTS];
+    uint16_t codeword_start = NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE+NGH_SIZE_TAG_SIZE;
+
+    memcpy(ref, pkt, pkt_len);
+
+    BENCH_CHECK(bench_ngham_decode_pkt(pkt, pkt_len, msg, &msg_len, NULL, 0) == PKT_CONDITION_OK);
+    BENCH_CHECK((msg_len == NGHAM_PL_MAX) && (memcmp(msg, payload, NGHAM_PL_MAX) == 0));
+
+    bench_rs_corrupt(&pkt[codeword_start], NGH_PL_PAR_SIZE[6], 16);
+    BENCH_CHECK(bench_ngham_decode_pkt(pkt, pkt_len, msg, &msg_len, NULL, 0) == PKT_CONDITION_OK);
+    BENCH_CHECK((msg_len == NGHAM_PL_MAX) && (memcmp(msg, payload, NGHAM_PL_MAX) == 0));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += bench_ngham_decode_pkt(pkt, pkt_len, msg, &msg_len, NULL, 0);
+    }
+    bench_stop(&timer, "ngham_decode (220 B, 16 errors)", iterations, NGHAM_PL_MAX);
+
+    // 32 corrupted bytes are beyond the error correction capacity, unless the radio flags them as erasures
+    memcpy(pkt, ref, pkt_len);
+    bench_rs_corrupt(&pkt[codeword_start], NGH_PL_PAR_SIZE[6], FEC_MAX_NROOTS);
+    for(i=0; i<FEC_MAX_NROOTS; i++)
+    {
+        eras_pos[i] = codeword_start + (i*NGH_PL_PAR_SIZE[6])/FEC_MAX_NROOTS;
+    }
+
+    BENCH_CHECK(bench_ngham_decode_pkt(pkt, pkt_len, msg, &msg_len, NULL, 0) == PKT_CONDITION_FAIL);
+    BENCH_CHECK(bench_ngham_decode_pkt(pkt, pkt_len, msg, &msg_len, eras_pos, FEC_MAX_NROOTS) == PKT_CONDITION_OK);
+    BENCH_CHECK((msg_len == NGHAM_PL_MAX) && (memcmp(msg, payload, NGHAM_PL_MAX) == 0));
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += bench_ngham_decode_pkt(pkt, pkt_len, msg, &msg_len, eras_pos, FEC_MAX_NROOTS);
+    }
+    bench_stop(&timer, "ngham_decode (220 B, 32 erasures)", iterations, NGHAM_PL_MAX);
+
+    // Block decoding gives the same result for any block length, erasures included
+    NGHamDecoder dec;
+    const uint16_t blocks[] = {1, 2, 7, 64, NGH_MAX_TOT_SIZE};
+
+    ngham_decoder_init(&dec);
+    for(i=0; i<sizeof(blocks)/sizeof(blocks[0]); i++)
+    {
+        memset(msg, 0, sizeof(msg));
+        BENCH_CHECK(bench_ngham_decode_blocks(&dec, pkt, pkt_len, blocks[i], eras_pos, FEC_MAX_NROOTS, msg, &msg_len) == PKT_CONDITION_OK);
+        BENCH_CHECK((msg_len == NGHAM_PL_MAX) && (memcmp(msg, payload, NGHAM_PL_MAX) == 0));
+    }
+
+    // Two packets in the same block: decoding stops at the end of the first one
+    uint8_t two_pkts[2*NGH_MAX_TOT_SIZE];
+    uint16_t first_len = pkt_len - (NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE);
+    uint16_t consumed = 0;
+
+    ngham_tx_pkt_gen(&tx_pkt, payload, 60);
+    ngham_encode(&tx_pkt, pkt, &pkt_len);
+    memcpy(two_pkts, &ref[NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE], first_len);
+    memcpy(&two_pkts[first_len], &pkt[NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE], pkt_len - (NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE));
+
+    BENCH_CHECK(ngham_decode_block(&dec, two_pkts, sizeof(two_pkts), &consumed, msg, &msg_len) == PKT_CONDITION_OK);
+    BENCH_CHECK((consumed == first_len) && (msg_len == NGHAM_PL_MAX) && (memcmp(msg, payload, NGHAM_PL_MAX) == 0));
+    BENCH_CHECK(ngham_decode_block(&dec, &two_pkts[first_len], sizeof(two_pkts) - first_len, &consumed, msg, &msg_len) == PKT_CONDITION_OK);
+    BENCH_CHECK((msg_len == 60) && (memcmp(msg, payload, 60) == 0));
+
+    // Per-byte against block decoding of a clean packet
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += bench_ngham_decode_pkt(ref, first_len + NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE, msg, &msg_len, NULL, 0);
+    }
+    bench_stop(&timer, "ngham_decode (220 B, no errors)", iterations, NGHAM_PL_MAX);
+
+    bench_start(&timer);
+    for(i=0; i<iterations; i++)
+    {
+        bench_sink += ngham_decode_block(&dec, &ref[NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE], first_len, &consumed, msg, &msg_len);
+    }
+    bench_stop(&timer, "ngham_decode_block (220 B, no errors)", iterations, NGHAM_PL_MAX);
+}
+
+//! \} End of host_bench group
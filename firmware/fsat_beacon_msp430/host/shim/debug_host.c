@@ -0,0 +1,161 @@
+/*
+ * debug_host.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Host implementation of the debug module.
+ * 
+ * The debug messages are written to stderr when HOST_DEBUG_ENABLED is 1, and
+ * discarded otherwise (the default), so benchmarks are not I/O bound.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup host_shim Shim
+ * \ingroup host
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <system/debug/debug.h>
+
+#ifndef HOST_DEBUG_ENABLED
+#define HOST_DEBUG_ENABLED      0
+#endif // HOST_DEBUG_ENABLED
+
+bool debug_init()
+{
+    return debug_uart_init();
+}
+
+void debug_set_color(uint8_t color)
+{
+}
+
+void debug_reset_color()
+{
+}
+
+void debug_print_event(uint8_t type, const char *event)
+{
+    switch(type)
+    {
+        case DEBUG_WARNING:
+            debug_print_msg("[WARNING] ");
+            break;
+        case DEBUG_ERROR:
+            debug_print_msg("[ERROR] ");
+            break;
+    }
+
+    debug_print_msg(event);
+}
+
+void debug_print_event_from_module(uint8_t type, const char *module, const char *event)
+{
+    debug_print_msg(module);
+    debug_print_msg(": ");
+
+    debug_print_event(type, event);
+}
+
+void debug_print_msg(const char *msg)
+{
+    while(*msg)
+    {
+        debug_uart_write_byte((uint8_t)*msg++);
+    }
+}
+
+void debug_print_digit(uint8_t d)
+{
+    if (d < 10)
+    {
+        debug_uart_write_byte('0' + d);
+    }
+    else
+    {
+        debug_uart_write_byte('?');
+    }
+}
+
+void debug_print_dec(uint32_t dec)
+{
+    char str[11];
+
+    snprintf(str, sizeof(str), "%lu", (unsigned long)dec);
+
+    debug_print_msg(str);
+}
+
+void debug_print_hex(uint32_t hex)
+{
+    char str[11];
+
+    snprintf(str, sizeof(str), "0x%02lX", (unsigned long)hex);
+
+    debug_print_msg(str);
+}
+
+void debug_print_byte(uint8_t byte)
+{
+    debug_uart_write_byte(byte);
+}
+
+void debug_print_system_time()
+{
+}
+
+void debug_print_license_msg()
+{
+}
+
+void debug_print_splash_screen()
+{
+}
+
+void debug_print_firmware_version()
+{
+}
+
+void debug_abort()
+{
+    abort();
+}
+
+bool debug_uart_init()
+{
+    return true;
+}
+
+void debug_uart_write_byte(uint8_t byte)
+{
+#if HOST_DEBUG_ENABLED == 1
+    fputc(byte, stderr);
+#endif // HOST_DEBUG_ENABLED
+}
+
+//! \} End of host_shim group
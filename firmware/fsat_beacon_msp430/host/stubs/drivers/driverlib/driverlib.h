@@ -0,0 +1,54 @@
+/*
+ * driverlib.h
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Host stub of the MSP430 DriverLib.
+ * 
+ * The configuration headers (config/config.h and config/pinmap.h) include the
+ * DriverLib only to resolve register and peripheral macros, which are never
+ * expanded by the host-built modules. This header shadows the real DriverLib
+ * in the host include path.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup host_stubs
+ * \{
+ */
+
+#ifndef HOST_DRIVERLIB_H_
+#define HOST_DRIVERLIB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <msp430.h>
+
+#define STATUS_SUCCESS                  0x01
+#define STATUS_FAIL                     0x00
+
+#endif // HOST_DRIVERLIB_H_
+
+//! \} End of host_stubs group
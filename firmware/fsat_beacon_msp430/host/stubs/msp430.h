@@ -0,0 +1,60 @@
+/*
+ * msp430.h
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Host stub of the MSP430 device header.
+ * 
+ * Only the compiler intrinsics used by the protocol core are provided. They
+ * are no-ops on the host, since there is no interrupt controller or low-power
+ * mode to drive.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup host_stubs Stubs
+ * \ingroup host
+ * \{
+ */
+
+#ifndef HOST_MSP430_H_
+#define HOST_MSP430_H_
+
+#include <stdint.h>
+
+#define __disable_interrupt()           do { } while(0)
+#define __enable_interrupt()            do { } while(0)
+#define __no_operation()                do { } while(0)
+#define __delay_cycles(cycles)          do { (void)(cycles); } while(0)
+#define __bis_SR_register(bits)         do { (void)(bits); } while(0)
+#define __bic_SR_register(bits)         do { (void)(bits); } while(0)
+#define __bic_SR_register_on_exit(bits) do { (void)(bits); } while(0)
+
+#define LPM1_bits                       0x0050
+#define LPM1_EXIT                       __bic_SR_register_on_exit(LPM1_bits)
+#define GIE                             0x0008
+
+#endif // HOST_MSP430_H_
+
+//! \} End of host_stubs group
@@ -0,0 +1,133 @@
+/*
+ * ax25_rx.c
+ *
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ *
+ * This file is part of FloripaSat-TTC.
+ *
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief AX.25 decoder and reassembler of raw bit streams (ground station captures, UART radio simulator output, etc.).
+ *
+ * Reads the stream from stdin (bytes, MSB first) and prints one line per received block (a single packet, or all
+ * the segments of a segmented block).
+ *
+ * Usage: ax25_rx [-g] < capture.bin
+ *
+ *      -g: the stream is NRZI coded and G3RUH scrambled (9600 bps).
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \addtogroup host_tools
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <src/ax25/ax25.h>
+
+int main(int argc, char **argv)
+{
+    static uint8_t block[AX25_SEG_MAX_LEN];
+    static AX25_Packet pkt;
+    AX25_Decoder dec;
+    AX25_Reassembler reasm;
+    AX25_G3RUH g3ruh;
+    uint8_t line_coding = 0;
+    uint8_t data[4096];
+    unsigned long frames = 0;
+    unsigned long blocks = 0;
+    unsigned long fail = 0;
+    size_t len = 0;
+    size_t i = 0;
+    int j = 0;
+
+    for(j=1; j<argc; j++)
+    {
+        if (strcmp(argv[j], "-g") == 0)
+        {
+            line_coding = 1;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [-g] < capture.bin\n", argv[0]);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    ax25_decoder_init(&dec);
+    ax25_reassembler_init(&reasm, block, sizeof(block));
+    ax25_g3ruh_init(&g3ruh);
+
+    while((len = fread(data, 1, sizeof(data), stdin)) > 0)
+    {
+        if (line_coding)
+        {
+            ax25_g3ruh_decode(&g3ruh, data, len);
+        }
+
+        for(i=0; i<len; i++)
+        {
+            uint8_t state = ax25_decode(&dec, data[i], &pkt);
+
+            if (state == AX25_DECODE_FAIL)
+            {
+                fail++;
+            }
+
+            if (state != AX25_DECODE_OK)
+            {
+                continue;
+            }
+
+            frames++;
+
+            state = ax25_reassemble(&reasm, &pkt);
+
+            if (state == AX25_DECODE_OK)
+            {
+                uint16_t k = 0;
+
+                printf("PID %02X, %5u:", reasm.pid, reasm.len);
+                for(k=0; k<reasm.len; k++)
+                {
+                    printf(" %02X", reasm.data[k]);
+                }
+                printf("\n");
+
+                blocks++;
+            }
+            else if (state == AX25_DECODE_FAIL)
+            {
+                fail++;
+            }
+        }
+    }
+
+    fprintf(stderr, "%lu frames decoded, %lu blocks reassembled, %lu failed\n", frames, blocks, fail);
+
+    return EXIT_SUCCESS;
+}
+
+//! \} End of host_tools group
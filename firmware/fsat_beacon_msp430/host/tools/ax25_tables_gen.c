@@ -0,0 +1,175 @@
+/*
+ * ax25_tables_gen.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Generator of the AX.25 lookup tables (src/ax25/ax25_tables.c).
+ * 
+ * Builds the bit stuffing table, indexed by the number of consecutive "1" bits
+ * already sent and the next input byte, and the NRZI table, and writes them as
+ * C arrays to stdout. The FCS table is shared with the other CRC-16/X.25 users
+ * (see host/tools/crc_tables_gen.c).
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup host_tools
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <src/ax25/ax25.h>
+
+/**
+ * \brief Stuffs one byte (LSB first), bit by bit.
+ * 
+ * \param ones is the number of consecutive "1" bits before the byte.
+ * \param byte is the input byte.
+ * 
+ * \return The table entry (see AX25_STUFF_* in ax25.h).
+ */
+static uint16_t gen_stuff_byte(int ones, int byte)
+{
+    uint16_t out = 0;
+    int out_bits = 0;
+    int i = 0;
+
+    for(i=0; i<8; i++)
+    {
+        int b = (byte >> i) & 0x01;
+
+        out = (out << 1) | b;
+        out_bits++;
+
+        ones = b? ones + 1 : 0;
+        if (ones == 5)
+        {
+            out <<= 1;
+            out_bits++;
+            ones = 0;
+        }
+    }
+
+    return out | ((out_bits - 8) << AX25_STUFF_EXTRA_POS) | (ones << AX25_STUFF_ONES_POS);
+}
+
+/**
+ * \brief NRZI encodes one byte (MSB first), starting from the level 0.
+ * 
+ * \param byte is the input byte.
+ * 
+ * \return The line levels (MSB first).
+ */
+static uint8_t gen_nrzi_byte(int byte)
+{
+    uint8_t out = 0;
+    int level = 0;
+    int i = 0;
+
+    for(i=7; i>=0; i--)
+    {
+        if (((byte >> i) & 0x01) == 0)
+        {
+            level ^= 1;     // A "0" bit is a level transition
+        }
+
+        out |= level << i;
+    }
+
+    return out;
+}
+
+int main()
+{
+    int ones = 0;
+    int i = 0;
+
+    printf("/*\n"
+           " * ax25_tables.c\n"
+           " * \n"
+           " * Copyright (C) 2016-2019, Universidade Federal de Santa Catarina.\n"
+           " * \n"
+           " * This file is part of FloripaSat-TTC.\n"
+           " * \n"
+           " * FloripaSat-TTC is free software: you can redistribute it and/or modify\n"
+           " * it under the terms of the GNU General Public License as published by\n"
+           " * the Free Software Foundation, either version 3 of the License, or\n"
+           " * (at your option) any later version.\n"
+           " * \n"
+           " * FloripaSat-TTC is distributed in the hope that it will be useful,\n"
+           " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+           " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+           " * GNU General Public License for more details.\n"
+           " * \n"
+           " * You should have received a copy of the GNU General Public License\n"
+           " * along with FloripaSat-TTC. If not, see <http://www.gnu.org/licenses/>.\n"
+           " * \n"
+           " */\n"
+           "\n"
+           "/**\n"
+           " * \\brief AX25 lookup tables.\n"
+           " * \n"
+           " * Generated by host/tools/ax25_tables_gen.c (make -C host ax25_tables). Do not edit.\n"
+           " * \n"
+           " * \\author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>\n"
+           " * \n"
+           " * \\version 1.0-dev\n"
+           " * \n"
+           " * \\date 18/10/2026\n"
+           " * \n"
+           " * \\addtogroup ax25\n"
+           " * \\{\n"
+           " */\n"
+           "\n"
+           "#include \"ax25.h\"\n"
+           "\n");
+
+    printf("const uint16_t ax25_stuffing_table[AX25_STUFF_MAX_ONES][256] = {\n");
+    for(ones=0; ones<AX25_STUFF_MAX_ONES; ones++)
+    {
+        printf("    {");
+        for(i=0; i<256; i++)
+        {
+            printf("%s0x%04X%s", (i % 10 == 0)? "\n        " : " ", gen_stuff_byte(ones, i), (i < 255)? "," : "\n");
+        }
+        printf("    }%s\n", (ones < AX25_STUFF_MAX_ONES-1)? "," : "");
+    }
+    printf("};\n\n");
+
+    printf("const uint8_t ax25_nrzi_table[256] = {");
+    for(i=0; i<256; i++)
+    {
+        printf("%s0x%02X%s", (i % 12 == 0)? "\n    " : " ", gen_nrzi_byte(i), (i < 255)? "," : "\n");
+    }
+    printf("};\n\n");
+
+    printf("//! \\} End of ax25 implementation group\n");
+
+    return EXIT_SUCCESS;
+}
+
+//! \} End of host_tools group
@@ -0,0 +1,218 @@
+/*
+ * crc_tables_gen.c
+ *
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ *
+ * This file is part of FloripaSat-TTC.
+ *
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Generator of the CRC lookup tables (src/crc/crc_tables.c).
+ *
+ * Builds the 4 slice-by-4 tables of each 16 bits polynomial, in the register orientation of the CRC engine (see crc.h),
+ * and the CRC8-CCITT table, and writes them as C arrays to stdout. Only the first table of each 16 bits polynomial is
+ * compiled in the MSP430 build (CRC_SLICES = 1).
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \addtogroup host_tools
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <src/crc/crc.h>
+
+/**
+ * \brief Number of generated tables per polynomial.
+ */
+#define CRC_TABLES_GEN_SLICES           4
+
+/**
+ * \brief Computes the tables of a 16 bits polynomial.
+ *
+ * \param poly is the polynomial (normal representation, without the x^16 term).
+ * \param reflected is 1 for a LSB first CRC, 0 for a MSB first CRC.
+ * \param table is the output tables.
+ *
+ * \return None.
+ */
+static void gen_tables(uint16_t poly, int reflected, uint16_t table[CRC_TABLES_GEN_SLICES][256])
+{
+    uint16_t rpoly = 0;
+    int i = 0;
+    int j = 0;
+
+    for(i=0; i<16; i++)
+    {
+        rpoly = (rpoly << 1) | ((poly >> i) & 0x0001);
+    }
+
+    for(i=0; i<256; i++)
+    {
+        uint16_t crc = reflected? i : i << 8;
+
+        for(j=0; j<8; j++)
+        {
+            if (reflected)
+            {
+                crc = (crc & 0x0001)? (crc >> 1) ^ rpoly : crc >> 1;
+            }
+            else
+            {
+                crc = (crc & 0x8000)? (crc << 1) ^ poly : crc << 1;
+            }
+        }
+
+        table[0][i] = crc;
+    }
+
+    // Each table advances the previous one by one more zero byte
+    for(j=1; j<CRC_TABLES_GEN_SLICES; j++)
+    {
+        for(i=0; i<256; i++)
+        {
+            uint16_t crc = table[j-1][i];
+
+            table[j][i] = reflected? (crc >> 8) ^ table[0][crc & 0xFF] : (uint16_t)(crc << 8) ^ table[0][crc >> 8];
+        }
+    }
+}
+
+/**
+ * \brief Computes the CRC8 (MSB first) of one byte.
+ *
+ * \param poly is the polynomial (without the x^8 term).
+ * \param byte is the input byte.
+ *
+ * \return The table entry.
+ */
+static uint8_t gen_crc8_byte(uint8_t poly, int byte)
+{
+    uint8_t crc = byte;
+    int i = 0;
+
+    for(i=0; i<8; i++)
+    {
+        crc = (crc & 0x80)? (crc << 1) ^ poly : crc << 1;
+    }
+
+    return crc;
+}
+
+/**
+ * \brief Prints the tables of a polynomial as a C array.
+ *
+ * \param name is the name of the array.
+ * \param table is the tables.
+ *
+ * \return None.
+ */
+static void print_tables(const char *name, uint16_t table[CRC_TABLES_GEN_SLICES][256])
+{
+    int j = 0;
+    int i = 0;
+
+    printf("const uint16_t %s[CRC_SLICES][256] = {\n", name);
+    for(j=0; j<CRC_TABLES_GEN_SLICES; j++)
+    {
+        if (j == 1)
+        {
+            printf("#if CRC_SLICES == %d\n", CRC_TABLES_GEN_SLICES);
+        }
+
+        printf("    {");
+        for(i=0; i<256; i++)
+        {
+            printf("%s0x%04X%s", (i % 10 == 0)? "\n        " : " ", table[j][i], (i < 255)? "," : "\n");
+        }
+        printf("    }%s\n", (j < CRC_TABLES_GEN_SLICES-1)? "," : "");
+    }
+    printf("#endif // CRC_SLICES\n");
+    printf("};\n\n");
+}
+
+int main()
+{
+    static uint16_t table[CRC_TABLES_GEN_SLICES][256];
+    int i = 0;
+
+    printf("/*\n"
+           " * crc_tables.c\n"
+           " * \n"
+           " * Copyright (C) 2017, Federal University of Santa Catarina\n"
+           " * \n"
+           " * This file is part of FloripaSat-TTC.\n"
+           " * \n"
+           " * FloripaSat-TTC is free software: you can redistribute it and/or modify\n"
+           " * it under the terms of the GNU General Public License as published by\n"
+           " * the Free Software Foundation, either version 3 of the License, or\n"
+           " * (at your option) any later version.\n"
+           " * \n"
+           " * FloripaSat-TTC is distributed in the hope that it will be useful,\n"
+           " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+           " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+           " * GNU General Public License for more details.\n"
+           " * \n"
+           " * You should have received a copy of the GNU General Public License\n"
+           " * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.\n"
+           " * \n"
+           " */\n"
+           "\n"
+           "/**\n"
+           " * \\brief CRC lookup tables.\n"
+           " * \n"
+           " * Generated by host/tools/crc_tables_gen.c (make -C host crc_tables). Do not edit.\n"
+           " * \n"
+           " * \\author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>\n"
+           " * \n"
+           " * \\version 1.0-dev\n"
+           " * \n"
+           " * \\date 18/10/2026\n"
+           " * \n"
+           " * \\addtogroup crc\n"
+           " * \\{\n"
+           " */\n"
+           "\n"
+           "#include \"crc.h\"\n"
+           "\n");
+
+    gen_tables(0x1021, 0, table);
+    print_tables("crc16_ccitt_table", table);
+
+    gen_tables(0x1021, 1, table);
+    print_tables("crc16_ccitt_reflected_table", table);
+
+    printf("const uint8_t crc8_ccitt_table[256] = {");
+    for(i=0; i<256; i++)
+    {
+        printf("%s0x%02X%s", (i % 12 == 0)? "\n    " : " ", gen_crc8_byte(CRC8_CCITT_POLYNOMIAL, i), (i < 255)? "," : "\n");
+    }
+    printf("};\n\n");
+
+    printf("//! \\} End of crc group\n");
+
+    return EXIT_SUCCESS;
+}
+
+//! \} End of host_tools group
@@ -0,0 +1,220 @@
+/*
+ * fec_tables_gen.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Generator of the Reed-Solomon lookup tables (src/ngham/fec_tables.c).
+ * 
+ * Builds the GF(2^8) log/antilog tables and the generator polynomials of the
+ * NGHam Reed-Solomon codes, and writes them as C arrays to stdout. The tables
+ * are stored in flash, so the firmware does not need to compute them at
+ * runtime or allocate any memory for them.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup host_tools Tools
+ * \ingroup host
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <src/ngham/fec.h>
+
+static uint8_t alpha_to[2*FEC_NN];
+static uint8_t index_of[FEC_NN+1];
+
+static int gen_modnn(int x)
+{
+    while(x >= FEC_NN)
+    {
+        x -= FEC_NN;
+        x = (x >> FEC_MM) + (x & FEC_NN);
+    }
+
+    return x;
+}
+
+static int gen_gf_tables()
+{
+    int i = 0;
+    int sr = 1;
+
+    index_of[0] = FEC_NN;   // log(zero) = -inf, callers never look up alpha**-inf
+
+    for(i=0; i<FEC_NN; i++)
+    {
+        index_of[sr] = i;
+        alpha_to[i] = sr;
+
+        sr <<= 1;
+        if (sr & (1 << FEC_MM))
+        {
+            sr ^= FEC_GFPOLY;
+        }
+        sr &= FEC_NN;
+    }
+
+    // Second period of the antilog table, for index sums up to 2*nn-1 (alpha**nn = alpha**0)
+    for(i=0; i<FEC_NN; i++)
+    {
+        alpha_to[FEC_NN + i] = alpha_to[i];
+    }
+
+    // The field generator polynomial must be primitive
+    return (sr == 1)? 0 : -1;
+}
+
+static void gen_genpoly(uint8_t *genpoly, int nroots)
+{
+    int i = 0;
+    int j = 0;
+    int root = FEC_FCR*FEC_PRIM;
+
+    genpoly[0] = 1;
+    for(i=0; i<nroots; i++, root+=FEC_PRIM)
+    {
+        genpoly[i+1] = 1;
+
+        // Multiply genpoly[] by  @**(root + x)
+        for(j=i; j>0; j--)
+        {
+            if (genpoly[j] != 0)
+            {
+                genpoly[j] = genpoly[j-1] ^ alpha_to[gen_modnn(index_of[genpoly[j]] + root)];
+            }
+            else
+            {
+                genpoly[j] = genpoly[j-1];
+            }
+        }
+
+        // genpoly[0] can never be zero
+        genpoly[0] = alpha_to[gen_modnn(index_of[genpoly[0]] + root)];
+    }
+
+    // Convert genpoly[] to index form for quicker encoding
+    for(i=0; i<=nroots; i++)
+    {
+        genpoly[i] = index_of[genpoly[i]];
+    }
+}
+
+static void gen_print_array(const char *name, const char *size, const uint8_t *data, int len)
+{
+    int i = 0;
+
+    printf("const uint8_t %s[%s] = {", name, size);
+    for(i=0; i<len; i++)
+    {
+        printf("%s0x%02X%s", (i % 12 == 0)? "\n    " : " ", data[i], (i < len-1)? "," : "\n");
+    }
+    printf("};\n\n");
+}
+
+int main()
+{
+    uint8_t genpoly_16[FEC_NROOTS_SHORT+1];
+    uint8_t genpoly_32[FEC_NROOTS_LONG+1];
+    uint8_t syn_root[FEC_MAX_NROOTS];
+    int i = 0;
+
+    if (gen_gf_tables() != 0)
+    {
+        fprintf(stderr, "FEC_GFPOLY is not a primitive polynomial!\n");
+
+        return EXIT_FAILURE;
+    }
+
+    if (gen_modnn(FEC_PRIM*FEC_IPRIM) != 1)
+    {
+        fprintf(stderr, "FEC_IPRIM is not the prim-th root of 1!\n");
+
+        return EXIT_FAILURE;
+    }
+
+    gen_genpoly(genpoly_16, FEC_NROOTS_SHORT);
+    gen_genpoly(genpoly_32, FEC_NROOTS_LONG);
+
+    for(i=0; i<FEC_MAX_NROOTS; i++)
+    {
+        syn_root[i] = gen_modnn((FEC_FCR + i)*FEC_PRIM);
+    }
+
+    printf("/*\n"
+           " * fec_tables.c\n"
+           " *\n"
+           " * Copyright (C) 2004, Phil Karn\n"
+           " * Copyright (C) 2017, Gabriel Mariano Marcelino\n"
+           " * \n"
+           " * This file is part of FloripaSat-TTC\n"
+           " *\n"
+           " * This program is free software: you can redistribute it and/or modify\n"
+           " * it under the terms of the GNU Lesser General Public License as\n"
+           " * published by the Free Software Foundation, either version 3 of the\n"
+           " * License, or (at your option) any later version.\n"
+           " *\n"
+           " * This program is distributed in the hope that it will be useful,\n"
+           " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+           " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+           " * GNU Lesser General Public License for more details.\n"
+           " *\n"
+           " * You should have received a copy of the GNU Lesser General Public\n"
+           " * License along with this program; if not, see <http://www.gnu.org/licenses/>\n"
+           " * \n"
+           " */\n"
+           "\n"
+           "/**\n"
+           " * \\brief Reed-Solomon lookup tables.\n"
+           " * \n"
+           " * Generated by host/tools/fec_tables_gen.c (make -C host fec_tables). Do not edit.\n"
+           " * \n"
+           " * \\author Phil Karn <karn@ka9q.net>\n"
+           " * \\author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>\n"
+           " * \n"
+           " * \\version 1.0-dev\n"
+           " * \n"
+           " * \\date 18/10/2026\n"
+           " * \n"
+           " * \\addtogroup fec\n"
+           " * \\{\n"
+           " */\n"
+           "\n"
+           "#include \"fec.h\"\n"
+           "\n");
+
+    gen_print_array("fec_alpha_to", "2*FEC_NN", alpha_to, 2*FEC_NN);
+    gen_print_array("fec_index_of", "FEC_NN+1", index_of, FEC_NN+1);
+    gen_print_array("fec_genpoly_16", "FEC_NROOTS_SHORT+1", genpoly_16, FEC_NROOTS_SHORT+1);
+    gen_print_array("fec_genpoly_32", "FEC_NROOTS_LONG+1", genpoly_32, FEC_NROOTS_LONG+1);
+    gen_print_array("fec_syn_root", "FEC_MAX_NROOTS", syn_root, FEC_MAX_NROOTS);
+
+    printf("//! \\} End of fec implementation group\n");
+
+    return EXIT_SUCCESS;
+}
+
+//! \} End of host_tools group
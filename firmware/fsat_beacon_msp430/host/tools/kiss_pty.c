@@ -0,0 +1,351 @@
+/*
+ * kiss_pty.c
+ *
+ * Copyright (C) 2017, Federal University of Santa Catarina.
+ *
+ * This file is part of FloripaSat-TTC.
+ *
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief KISS TNC bridge between the UART radio simulator and a pseudo terminal.
+ *
+ * The simulator sends each transmission (the on-air bit stream) as a KISS data frame, and takes the KISS data
+ * frames it receives as received packets. This tool creates a pty that behaves as a KISS TNC, so the beacon can be
+ * attached to Direwolf, kissattach, kissutil or any other KISS client:
+ *      - By default the AX.25 frames are decoded from the transmissions and sent to the client as standard KISS
+ *        data frames (address field to information field, no FCS), and the frames from the client are encoded
+ *        (FCS, bit stuffing and flags) and sent to the simulator. Repeater addresses are not supported.
+ *      - With -r the frames are forwarded unchanged both ways (on-air bytes, for NGHam or any other format).
+ *      .
+ *
+ * The simulator UART is the given device (configured beforehand with stty), or stdin/stdout.
+ *
+ * Usage: kiss_pty [-g] [-r] [device]
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \addtogroup host_tools
+ * \{
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <src/ax25/ax25.h>
+#include <src/kiss/kiss.h>
+
+/**
+ * \brief Longest frame in both directions (the longest transmission of the radio HAL).
+ */
+#define KISS_PTY_MAX_LEN                8191
+
+/**
+ * \brief Writes a whole buffer to a file descriptor.
+ *
+ * \param fd is the file descriptor.
+ * \param data is the buffer.
+ * \param len is the length of the buffer.
+ *
+ * \return 0 on success, -1 on error.
+ */
+static int write_all(int fd, const uint8_t *data, size_t len)
+{
+    while(len > 0)
+    {
+        ssize_t n = write(fd, data, len);
+
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return -1;
+        }
+
+        data += n;
+        len -= n;
+    }
+
+    return 0;
+}
+
+/**
+ * \brief Sends a KISS data frame (port 0).
+ *
+ * \param fd is the file descriptor.
+ * \param data is the data of the frame.
+ * \param len is the length of data.
+ *
+ * \return 0 on success, -1 on error.
+ */
+static int send_frame(int fd, const uint8_t *data, uint16_t len)
+{
+    static uint8_t frame[KISS_FRAME_MAX_LEN(KISS_PTY_MAX_LEN)];
+
+    return write_all(fd, frame, kiss_encode(KISS_TYPE(0, KISS_CMD_DATA), data, len, frame));
+}
+
+/**
+ * \brief Opens a pseudo terminal in raw mode.
+ *
+ * \param slave is the file descriptor of the slave side (kept open, so the master survives the client closing it).
+ *
+ * \return The file descriptor of the master side, or -1 on error.
+ */
+static int open_pty(int *slave)
+{
+    struct termios tio;
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if ((master < 0) || (grantpt(master) < 0) || (unlockpt(master) < 0))
+    {
+        return -1;
+    }
+
+    *slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if ((*slave < 0) || (tcgetattr(*slave, &tio) < 0))
+    {
+        return -1;
+    }
+
+    cfmakeraw(&tio);
+    tcsetattr(*slave, TCSANOW, &tio);
+
+    return master;
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t dev_buf[KISS_PTY_MAX_LEN];
+    static uint8_t pty_buf[KISS_PTY_MAX_LEN];
+    static uint8_t bits[KISS_PTY_MAX_LEN];
+    static AX25_Packet pkt;
+    static uint8_t str[AX25_FRAME_MAX_LEN + 2];
+    KISS_Decoder dev_kiss;
+    KISS_Decoder pty_kiss;
+    AX25_Decoder ax25_dec;
+    AX25_G3RUH g3ruh_rx;
+    AX25_G3RUH g3ruh_tx;
+    uint8_t line_coding = 0;
+    uint8_t raw = 0;
+    const char *device = NULL;
+    int dev_in = STDIN_FILENO;
+    int dev_out = STDOUT_FILENO;
+    int slave = -1;
+    int master = -1;
+    unsigned long to_client = 0;
+    unsigned long to_sim = 0;
+    int i = 0;
+
+    for(i=1; i<argc; i++)
+    {
+        if (strcmp(argv[i], "-g") == 0)
+        {
+            line_coding = 1;
+        }
+        else if (strcmp(argv[i], "-r") == 0)
+        {
+            raw = 1;
+        }
+        else if ((argv[i][0] != '-') && (device == NULL))
+        {
+            device = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [-g] [-r] [device]\n", argv[0]);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (device != NULL)
+    {
+        dev_in = open(device, O_RDWR | O_NOCTTY);
+        if (dev_in < 0)
+        {
+            perror(device);
+
+            return EXIT_FAILURE;
+        }
+
+        dev_out = dev_in;
+    }
+
+    master = open_pty(&slave);
+    if (master < 0)
+    {
+        perror("pty");
+
+        return EXIT_FAILURE;
+    }
+
+    fprintf(stderr, "KISS TNC at %s\n", ptsname(master));
+
+    kiss_decoder_init(&dev_kiss, dev_buf, sizeof(dev_buf));
+    kiss_decoder_init(&pty_kiss, pty_buf, sizeof(pty_buf));
+    ax25_decoder_init(&ax25_dec);
+    ax25_g3ruh_init(&g3ruh_rx);
+    ax25_g3ruh_init(&g3ruh_tx);
+
+    for(;;)
+    {
+        struct pollfd fds[2] = {{dev_in, POLLIN, 0}, {master, POLLIN, 0}};
+        uint8_t data[1024];
+        ssize_t len = 0;
+        ssize_t j = 0;
+
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        // Simulator to client
+        if (fds[0].revents)
+        {
+            len = read(dev_in, data, sizeof(data));
+            if (len <= 0)
+            {
+                break;
+            }
+
+            for(j=0; j<len; j++)
+            {
+                uint16_t k = 0;
+
+                if ((kiss_decode(&dev_kiss, data[j]) != KISS_DECODE_OK) || (dev_kiss.type != KISS_TYPE(0, KISS_CMD_DATA)))
+                {
+                    continue;
+                }
+
+                if (raw)
+                {
+                    send_frame(master, dev_kiss.data, dev_kiss.len);
+                    to_client++;
+
+                    continue;
+                }
+
+                if (line_coding)
+                {
+                    ax25_g3ruh_decode(&g3ruh_rx, dev_kiss.data, dev_kiss.len);
+                }
+
+                for(k=0; k<dev_kiss.len; k++)
+                {
+                    uint16_t str_len = 0;
+
+                    if (ax25_decode(&ax25_dec, dev_kiss.data[k], &pkt) != AX25_DECODE_OK)
+                    {
+                        continue;
+                    }
+
+                    // Without the flags and the FCS
+                    ax25_pkt_2_str(&pkt, str, &str_len);
+                    send_frame(master, &str[1], str_len - 1 - AX25_TRAILER_STR_LEN);
+                    to_client++;
+                }
+            }
+        }
+
+        // Client to simulator
+        if (fds[1].revents)
+        {
+            len = read(master, data, sizeof(data));
+            if (len <= 0)
+            {
+                continue;
+            }
+
+            for(j=0; j<len; j++)
+            {
+                AX25_Encoder encoder;
+                uint16_t fcs = 0;
+                uint16_t bits_len = 0;
+
+                if ((kiss_decode(&pty_kiss, data[j]) != KISS_DECODE_OK) || ((pty_kiss.type & 0x0F) != KISS_CMD_DATA))
+                {
+                    continue;
+                }
+
+                if (raw)
+                {
+                    send_frame(dev_out, pty_kiss.data, pty_kiss.len);
+                    to_sim++;
+
+                    continue;
+                }
+
+                if (pty_kiss.len > sizeof(str) - 2)
+                {
+                    continue;
+                }
+
+                // The FCS, LSB first, as received from the air
+                memcpy(str, pty_kiss.data, pty_kiss.len);
+                fcs = ax25_fcs_update(AX25_FCS_INIT, str, pty_kiss.len) ^ 0xFFFF;
+                str[pty_kiss.len]   = (uint8_t)(fcs & 0x00FF);
+                str[pty_kiss.len+1] = (uint8_t)(fcs >> 8);
+
+                if (ax25_str_2_pkt(str, pty_kiss.len + 2, &pkt) != AX25_DECODE_OK)
+                {
+                    fprintf(stderr, "Invalid AX.25 frame from the client (%u bytes)\n", pty_kiss.len);
+
+                    continue;
+                }
+
+                bits_len = ax25_encoder_init(&encoder, &pkt);
+                if (line_coding)
+                {
+                    ax25_encoder_set_g3ruh(&encoder, &g3ruh_tx);
+                }
+
+                ax25_encoder_read(&encoder, bits, bits_len);
+                send_frame(dev_out, bits, bits_len);
+                to_sim++;
+            }
+        }
+    }
+
+    fprintf(stderr, "%lu frames to the client, %lu frames to the simulator\n", to_client, to_sim);
+
+    close(master);
+    close(slave);
+
+    return EXIT_SUCCESS;
+}
+
+//! \} End of host_tools group
@@ -0,0 +1,115 @@
+/*
+ * ngham_rx.c
+ *
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ *
+ * This file is part of FloripaSat-TTC.
+ *
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief NGHam decoder of raw bit streams (ground station captures, UART radio simulator output, etc.).
+ *
+ * Reads the stream from stdin (bytes, MSB first, no framing needed) and prints one line per decoded packet.
+ *
+ * Usage: ngham_rx [-4] [-e max_errors] < capture.bin
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \addtogroup host_tools
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <src/ngham/ngham_sync.h>
+
+int main(int argc, char **argv)
+{
+    NGHamDecoder dec;
+    NGHamSync sync;
+    uint8_t four_level = 0;
+    uint8_t max_errors = NGH_SYNC_MAX_ERROR;
+    uint8_t data[4096];
+    uint8_t msg[NGHAM_PL_MAX];
+    uint8_t msg_len = 0;
+    unsigned long ok = 0;
+    unsigned long fail = 0;
+    size_t len = 0;
+    int i = 0;
+
+    for(i=1; i<argc; i++)
+    {
+        if (strcmp(argv[i], "-4") == 0)
+        {
+            four_level = 1;
+        }
+        else if ((strcmp(argv[i], "-e") == 0) && (i+1 < argc))
+        {
+            max_errors = (uint8_t)atoi(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [-4] [-e max_errors] < capture.bin\n", argv[0]);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    ngham_init();
+    ngham_sync_init(&sync, &dec, four_level, max_errors);
+
+    while((len = fread(data, 1, sizeof(data), stdin)) > 0)
+    {
+        uint16_t pos = 0;
+
+        while(pos < len)
+        {
+            uint16_t consumed = 0;
+            uint8_t state = ngham_sync_push(&sync, &data[pos], len - pos, &consumed, msg, &msg_len);
+
+            pos += consumed;
+
+            if (state == PKT_CONDITION_OK)
+            {
+                printf("%3u:", msg_len);
+                for(i=0; i<msg_len; i++)
+                {
+                    printf(" %02X", msg[i]);
+                }
+                printf("\n");
+
+                ok++;
+            }
+            else if (state == PKT_CONDITION_FAIL)
+            {
+                fail++;
+            }
+        }
+    }
+
+    fprintf(stderr, "%lu packets decoded, %lu failed\n", ok, fail);
+
+    return EXIT_SUCCESS;
+}
+
+//! \} End of host_tools group
@@ -35,190 +35,946 @@
  * \{
  */
 
+#include <stddef.h>
+
 #include <config/config.h>
-#include <src/crc/crc.h>
 #include <system/debug/debug.h>
+#include <src/crc/crc.h>
 
 #include "ax25.h"
 
-void ax25_beacon_pkt_gen(AX25_Packet *ax25_packet, uint8_t *data, uint16_t data_size)
+/**
+ * \brief Beacon header template (address, control and PID fields), built by ax25_init.
+ */
+static uint8_t ax25_beacon_header[AX25_HEADER_LEN];
+
+static uint16_t ax25_beacon_header_fcs;     /**< FCS state after the template (not inverted). */
+static uint16_t ax25_beacon_header_bits;    /**< Length of the template after the bit stuffing (in bits). */
+static uint8_t ax25_beacon_header_ones;     /**< Consecutive "1" bits at the end of the template. */
+
+void ax25_set_address(AX25_Transfer_Frame_Header *adr, const char *callsign, uint8_t ssid)
 {
-    debug_print_event_from_module(DEBUG_INFO, AX25_MODULE_NAME, "Generating AX25 packet...\n\r");
+    uint8_t i = 0;
 
-    AX25_Transfer_Frame_Header destination;
-    AX25_Transfer_Frame_Header source;
-    
-    uint8_t dst_callsign[] = AX25_DESTINATION_CALLSIGN;
-    uint8_t src_callsign[] = AX25_FLORIPASAT_CALLSIGN;
-    
+    for(i=0; i<AX25_ADR_LEN-1; i++)
+    {
+        adr->callsign[i] = ((*callsign != '\0')? *callsign++ : ' ') << 1;
+    }
+
+    adr->callsign[AX25_ADR_LEN-1] = 0;
+    adr->ssid = ssid;
+}
+
+/**
+ * \brief Checks if a frame has the PID field (only I and UI frames).
+ * 
+ * \param control is the control field of the frame.
+ * 
+ * \return 1 if the frame has the PID field, 0 otherwise.
+ */
+static uint8_t ax25_has_pid(uint8_t control)
+{
+    return ((control & 0x01) == AX25_CTRL_INFORMATION) || ((control & ~AX25_CTRL_PF_TRUE) == AX25_CTRL_UNNUMBERED_UI);
+}
+
+/**
+ * \brief Converts the header of a packet to a string of bytes.
+ * 
+ * \param ax25_packet is the packet.
+ * \param str is the array to store the header (AX25_HEADER_STR_LEN bytes).
+ * 
+ * \return The length of the header (AX25_HEADER_STR_LEN, or one byte less in frames without the PID field).
+ */
+static uint8_t ax25_header_2_str(const AX25_Packet *ax25_packet, uint8_t *str)
+{
     uint8_t i = 0;
-    for(i=0;i<7;i++)
+
+    str[0] = ax25_packet->start_flag;
+
+    for(i=0; i<AX25_ADR_LEN-1; i++)
     {
-        destination.callsign[i] = dst_callsign[i] << 1;
+        str[1+i]                = ax25_packet->dst_adr.callsign[i];
+        str[1+AX25_ADR_LEN+i]   = ax25_packet->src_adr.callsign[i];
     }
-    destination.ssid = AX25_ADR_NON_REPEATER_SSID | (uint8_t)(AX25_FLORIPASAT_GRS_SSID << 1) | AX25_ADR_DST_COMMAND;
-    
-    for(i=0;i<7;i++)
+
+    str[AX25_ADR_LEN]       = ax25_packet->dst_adr.ssid;
+    str[2*AX25_ADR_LEN]     = ax25_packet->src_adr.ssid;
+    str[2*AX25_ADR_LEN+1]   = ax25_packet->control_bits;
+
+    if (!ax25_has_pid(ax25_packet->control_bits))
     {
-        source.callsign[i] = src_callsign[i] << 1;
+        return AX25_HEADER_STR_LEN - 1;
     }
-    source.ssid = AX25_ADR_NON_REPEATER_SSID | (uint8_t)(AX25_FLORIPASAT_SAT_SSID << 1) | AX25_ADR_SRC_COMMAND;
-    
-    ax25_packet->start_flag     = AX25_FLAG;
-    ax25_packet->dst_adr        = destination;
-    ax25_packet->src_adr        = source;
-    ax25_packet->control_bits   = AX25_CTRL_UNNUMBERED_UI | AX25_CTRL_PF_DISABLE;
-    ax25_packet->protocol_id    = AX25_PID_NO_LAYER_3;
-    for(i=0;i<data_size;i++)
+
+    str[2*AX25_ADR_LEN+2]   = ax25_packet->protocol_id;
+
+    return AX25_HEADER_STR_LEN;
+}
+
+/**
+ * \brief Converts the end of a packet (FCS and flag) to a string of bytes.
+ * 
+ * \param ax25_packet is the packet.
+ * \param str is the array to store the end of the packet (AX25_TRAILER_STR_LEN bytes).
+ * 
+ * \return None.
+ */
+static void ax25_trailer_2_str(const AX25_Packet *ax25_packet, uint8_t *str)
+{
+    str[0] = (uint8_t)(ax25_packet->fcs & 0x00FF);         // FCS LSB first
+    str[1] = (uint8_t)((ax25_packet->fcs & 0xFF00) >> 8);
+    str[2] = ax25_packet->end_flag;
+}
+
+/**
+ * \brief Sets the header fields of a packet from a string of bytes.
+ * 
+ * \param ax25_packet is the packet.
+ * \param str is the address, control and PID fields (AX25_HEADER_LEN bytes).
+ * 
+ * \return None.
+ */
+static void ax25_str_2_header(AX25_Packet *ax25_packet, const uint8_t *str)
+{
+    uint8_t i = 0;
+
+    for(i=0; i<AX25_ADR_LEN-1; i++)
+    {
+        ax25_packet->dst_adr.callsign[i] = str[i];
+        ax25_packet->src_adr.callsign[i] = str[AX25_ADR_LEN+i];
+    }
+
+    ax25_packet->dst_adr.callsign[AX25_ADR_LEN-1]   = 0;
+    ax25_packet->src_adr.callsign[AX25_ADR_LEN-1]   = 0;
+    ax25_packet->dst_adr.ssid                       = str[AX25_ADR_LEN-1];
+    ax25_packet->src_adr.ssid                       = str[2*AX25_ADR_LEN-1];
+    ax25_packet->control_bits                       = str[2*AX25_ADR_LEN];
+    ax25_packet->protocol_id                        = str[2*AX25_ADR_LEN+1];
+}
+
+/**
+ * \brief Copies the payload of a packet, computing the FCS of the whole frame on the way.
+ * 
+ * \param ax25_packet is the packet, with the header fields already set.
+ * \param data is the payload.
+ * \param data_size is the length of the payload (up to 256 bytes).
+ * \param fcs is the FCS state after the header (not inverted).
+ * 
+ * \return None.
+ */
+static void ax25_set_payload(AX25_Packet *ax25_packet, const uint8_t *data, uint16_t data_size, uint16_t fcs)
+{
+    uint16_t i = 0;
+
+    for(i=0; i<data_size; i++)
     {
         ax25_packet->payload.data[i] = data[i];
     }
+
+    fcs = crc_update(&crc16_x25, fcs, data, data_size);
+
     ax25_packet->payload.len    = data_size;
-    ax25_packet->fcs            = crc16_CCITT(0x0000, data, data_size);
-    ax25_packet->end_flag       = AX25_FLAG;
+    ax25_packet->fcs            = fcs ^ 0xFFFF;
 }
 
-void ax25_update_data_from_pkt(AX25_Packet *ax25_packet, uint8_t *new_data, uint16_t new_data_size)
+/**
+ * \brief Counts the bits of a part of a packet after the bit stuffing.
+ * 
+ * \param data is the part of the packet.
+ * \param len is the length of data.
+ * \param ones is the number of consecutive "1" bits before data, updated to the number after it.
+ * 
+ * \return The number of bits.
+ */
+static uint16_t ax25_stuffed_bits(const uint8_t *data, uint16_t len, uint8_t *ones)
 {
-    debug_print_event_from_module(DEBUG_INFO, AX25_MODULE_NAME, "Updating an existing AX25 packet...\n\r");
+    uint16_t bits = 0;
+    uint16_t i = 0;
 
-    if (new_data_size > 256)
+    for(i=0; i<len; i++)
     {
-        new_data_size = 256;
+        uint16_t entry = ax25_stuffing_table[*ones][data[i]];
+
+        bits += 8 + ((entry >> AX25_STUFF_EXTRA_POS) & 0x03);
+        *ones = entry >> AX25_STUFF_ONES_POS;
     }
-    
+
+    return bits;
+}
+
+void ax25_init()
+{
+    AX25_Packet ax25_packet;
+    uint8_t str[AX25_HEADER_STR_LEN];
     uint8_t i = 0;
-    for(i=0;i<new_data_size;i++)
+
+    ax25_set_address(&ax25_packet.dst_adr, AX25_DESTINATION_CALLSIGN, AX25_ADR_NON_REPEATER_SSID | (uint8_t)(AX25_FLORIPASAT_GRS_SSID << 1) | AX25_ADR_DST_COMMAND);
+    ax25_set_address(&ax25_packet.src_adr, AX25_FLORIPASAT_CALLSIGN, AX25_ADR_NON_REPEATER_SSID | (uint8_t)(AX25_FLORIPASAT_SAT_SSID << 1) | AX25_ADR_SRC_COMMAND | AX25_ADR_LAST_ADDRESS);
+
+    ax25_packet.start_flag      = AX25_FLAG;
+    ax25_packet.control_bits    = AX25_CTRL_UNNUMBERED_UI | AX25_CTRL_PF_DISABLE;
+    ax25_packet.protocol_id     = AX25_PID_NO_LAYER_3;
+
+    ax25_header_2_str(&ax25_packet, str);
+
+    for(i=0; i<AX25_HEADER_LEN; i++)
     {
-        ax25_packet->payload.data[i] = new_data[i];
+        ax25_beacon_header[i] = str[1+i];
     }
-    ax25_packet->payload.len = new_data_size;
-    
-    ax25_packet->fcs = crc16_CCITT(0x0000, new_data, new_data_size);
+
+    // The FCS and the bit stuffing of the header are the same in every beacon packet
+    ax25_beacon_header_fcs = ax25_fcs_update(AX25_FCS_INIT, ax25_beacon_header, AX25_HEADER_LEN);
+
+    ax25_beacon_header_ones = 0;
+    ax25_beacon_header_bits = ax25_stuffed_bits(ax25_beacon_header, AX25_HEADER_LEN, &ax25_beacon_header_ones);
 }
 
-void ax25_pkt_2_str(AX25_Packet *ax25_packet, uint8_t *str_pkt, uint16_t *str_pkt_len)
+void ax25_beacon_pkt_gen(AX25_Packet *ax25_packet, uint8_t *data, uint16_t data_size)
 {
-    *str_pkt_len = 0;
-    
-    str_pkt[(*str_pkt_len)++] = ax25_packet->start_flag;
-    
-    uint8_t i = 0;
-    for(i=0; i<7; i++)
+    debug_print_event_from_module(DEBUG_INFO, AX25_MODULE_NAME, "Generating AX25 packet...\n\r");
+
+    if (data_size > 256)
     {
-        str_pkt[(*str_pkt_len)++] = ax25_packet->dst_adr.callsign[i];
+        data_size = 256;
     }
-    
-    str_pkt[(*str_pkt_len)++] = ax25_packet->dst_adr.ssid;
-    
-    for(i=0; i<7; i++)
+
+    ax25_str_2_header(ax25_packet, ax25_beacon_header);
+
+    ax25_packet->start_flag     = AX25_FLAG;
+    ax25_packet->end_flag       = AX25_FLAG;
+
+    ax25_set_payload(ax25_packet, data, data_size, ax25_beacon_header_fcs);
+}
+
+void ax25_update_data_from_pkt(AX25_Packet *ax25_packet, const uint8_t *new_data, uint16_t new_data_size)
+{
+    uint8_t header[AX25_HEADER_STR_LEN];
+    uint8_t header_len = 0;
+
+    if (new_data_size > 256)
     {
-        str_pkt[(*str_pkt_len)++] = ax25_packet->src_adr.callsign[i];
+        new_data_size = 256;
     }
-    
-    str_pkt[(*str_pkt_len)++] = ax25_packet->src_adr.ssid;
-    str_pkt[(*str_pkt_len)++] = ax25_packet->control_bits;
-    str_pkt[(*str_pkt_len)++] = ax25_packet->protocol_id;
+
+    // The header may not be the beacon one
+    header_len = ax25_header_2_str(ax25_packet, header);
+
+    ax25_set_payload(ax25_packet, new_data, new_data_size, ax25_fcs_update(AX25_FCS_INIT, &header[1], header_len-1));
+}
+
+void ax25_pkt_2_str(AX25_Packet *ax25_packet, uint8_t *str_pkt, uint16_t *str_pkt_len)
+{
+    uint16_t i = 0;
+
+    *str_pkt_len = ax25_header_2_str(ax25_packet, str_pkt);
     
     for(i=0; i<ax25_packet->payload.len; i++)
     {
         str_pkt[(*str_pkt_len)++] = ax25_packet->payload.data[i];
     }
     
-    str_pkt[(*str_pkt_len)++] = (uint8_t)((ax25_packet->fcs & 0xFF00) >> 8);  // CRC16 MSB
-    str_pkt[(*str_pkt_len)++] = (uint8_t)(ax25_packet->fcs & 0x00FF);         // CRC16 LSB
-    str_pkt[(*str_pkt_len)++] = ax25_packet->end_flag;
+    ax25_trailer_2_str(ax25_packet, &str_pkt[*str_pkt_len]);
+    *str_pkt_len += AX25_TRAILER_STR_LEN;
+}
+
+void ax25_stuffer_init(AX25_Stuffer *stuffer)
+{
+    stuffer->acc    = 0;
+    stuffer->bits   = 0;
+    stuffer->ones   = 0;
+}
+
+uint16_t ax25_stuffer_push(AX25_Stuffer *stuffer, const uint8_t *data, uint16_t len, uint8_t *out)
+{
+    uint16_t acc = stuffer->acc;
+    uint8_t bits = stuffer->bits;
+    uint8_t ones = stuffer->ones;
+    uint16_t out_len = 0;
+    uint16_t i = 0;
+
+    for(i=0; i<len; i++)
+    {
+        uint16_t entry = ax25_stuffing_table[ones][data[i]];
+        uint8_t extra = (entry >> AX25_STUFF_EXTRA_POS) & 0x03;
+
+        // Stuffed bits (rare): they go first, and complete an extra output byte every 8 of them
+        if (extra)
+        {
+            acc = (acc << extra) | ((entry >> 8) & 0x03);
+            bits += extra;
+            if (bits >= 8)
+            {
+                bits -= 8;
+                out[out_len++] = (uint8_t)(acc >> bits);
+            }
+        }
+
+        acc = (acc << 8) | (entry & 0xFF);
+        out[out_len++] = (uint8_t)(acc >> bits);
+
+        ones = entry >> AX25_STUFF_ONES_POS;
+    }
+
+    stuffer->acc    = acc;
+    stuffer->bits   = bits;
+    stuffer->ones   = ones;
+
+    return out_len;
+}
+
+uint8_t ax25_stuffer_flag(AX25_Stuffer *stuffer, uint8_t *out)
+{
+    // The flag is the same LSB or MSB first
+    stuffer->acc = (stuffer->acc << 8) | AX25_FLAG;
+    stuffer->ones = 0;
+
+    out[0] = (uint8_t)(stuffer->acc >> stuffer->bits);
+
+    return 1;
+}
+
+uint8_t ax25_stuffer_flush(AX25_Stuffer *stuffer, uint8_t *out)
+{
+    if (stuffer->bits == 0)
+    {
+        return 0;
+    }
+
+    out[0] = (uint8_t)(stuffer->acc << (8 - stuffer->bits));
+
+    stuffer->bits = 0;
+
+    return 1;
 }
 
 void ax25_bit_stuffing(uint8_t *pkt, uint16_t pkt_len, uint8_t *new_pkt, uint16_t *new_pkt_len)
 {
-    // STEP 1: Byte packet to bit packet
-    bit bit_pkt[8*(21+256)];        // 21 = header, 256 = payload, 8 = byte to bit conversion
-    
-    uint16_t bit_pkt_counter = 0;
+    AX25_Stuffer stuffer;
+
+    ax25_stuffer_init(&stuffer);
+
+    *new_pkt_len = ax25_stuffer_push(&stuffer, pkt, pkt_len, new_pkt);
+    *new_pkt_len += ax25_stuffer_flush(&stuffer, &new_pkt[*new_pkt_len]);
+}
+
+/**
+ * \brief Initializes a streaming encoder after its header was set.
+ * 
+ * \param encoder is the encoder state, with the header already set.
+ * \param payload is the payload of the packet.
+ * \param payload_len is the length of the payload.
+ * \param fcs is the FCS of the packet (inverted).
+ * \param header_bits is the length of the header after the bit stuffing (without the start flag, in bits).
+ * \param ones is the number of consecutive "1" bits at the end of the header.
+ * 
+ * \return The length of the encoded packet (in bytes).
+ */
+static uint16_t ax25_encoder_start(AX25_Encoder *encoder, const uint8_t *payload, uint16_t payload_len, uint16_t fcs, uint16_t header_bits, uint8_t ones)
+{
+    uint16_t bits = 0;
+
+    encoder->trailer[0]     = (uint8_t)(fcs & 0x00FF);      // FCS LSB first
+    encoder->trailer[1]     = (uint8_t)((fcs & 0xFF00) >> 8);
+    encoder->trailer[2]     = AX25_FLAG;
+
+    encoder->payload        = payload;
+    encoder->payload_len    = payload_len;
+    encoder->pos            = 0;
+    encoder->spill_len      = 0;
+    encoder->spill_pos      = 0;
+    encoder->flushed        = 0;
+    encoder->g3ruh          = NULL;
+
+    ax25_stuffer_init(&encoder->stuffer);
+
+    // The radio needs the length before the first byte (the flags are not stuffed)
+    bits += 8;
+    bits += header_bits;
+    bits += ax25_stuffed_bits(encoder->payload, encoder->payload_len, &ones);
+    bits += ax25_stuffed_bits(encoder->trailer, AX25_TRAILER_STR_LEN-1, &ones);
+    bits += 8;
+
+    encoder->len = (bits + 7)/8;
+
+    return encoder->len;
+}
+
+uint16_t ax25_encoder_init(AX25_Encoder *encoder, const AX25_Packet *ax25_packet)
+{
+    uint16_t header_bits = 0;
+    uint8_t ones = 0;
+
+    encoder->header_len = ax25_header_2_str(ax25_packet, encoder->header);
+
+    header_bits = ax25_stuffed_bits(&encoder->header[1], encoder->header_len-1, &ones);
+
+    return ax25_encoder_start(encoder, ax25_packet->payload.data, ax25_packet->payload.len, ax25_packet->fcs, header_bits, ones);
+}
+
+uint16_t ax25_beacon_encoder_init(AX25_Encoder *encoder, const uint8_t *data, uint16_t data_size)
+{
+    uint8_t i = 0;
+
+    if (data_size > 256)
+    {
+        data_size = 256;
+    }
+
+    encoder->header[0]  = AX25_FLAG;
+    encoder->header_len = AX25_HEADER_STR_LEN;
+
+    for(i=0; i<AX25_HEADER_LEN; i++)
+    {
+        encoder->header[1+i] = ax25_beacon_header[i];
+    }
+
+    return ax25_encoder_start(encoder, data, data_size, ax25_fcs_update(ax25_beacon_header_fcs, data, data_size) ^ 0xFFFF, ax25_beacon_header_bits, ax25_beacon_header_ones);
+}
+
+uint16_t ax25_encoder_read(AX25_Encoder *encoder, uint8_t *data, uint16_t len)
+{
+    uint16_t payload_end = encoder->header_len + encoder->payload_len;
+    uint16_t out_len = 0;
+
+    while(out_len < len)
+    {
+        const uint8_t *src;
+        uint16_t n;
+        int32_t max_n;
+
+        if (encoder->spill_pos < encoder->spill_len)
+        {
+            data[out_len++] = encoder->spill[encoder->spill_pos++];
+            continue;
+        }
+
+        // Start and end flags, without bit stuffing
+        if ((encoder->pos == 0) || (encoder->pos == payload_end + AX25_TRAILER_STR_LEN - 1))
+        {
+            out_len += ax25_stuffer_flag(&encoder->stuffer, &data[out_len]);
+            encoder->pos++;
+
+            continue;
+        }
+
+        // The contiguous rest of the current part of the packet (header, payload or FCS)
+        if (encoder->pos < encoder->header_len)
+        {
+            src = &encoder->header[encoder->pos];
+            n = encoder->header_len - encoder->pos;
+        }
+        else if (encoder->pos < payload_end)
+        {
+            src = &encoder->payload[encoder->pos - encoder->header_len];
+            n = payload_end - encoder->pos;
+        }
+        else if (encoder->pos < payload_end + AX25_TRAILER_STR_LEN - 1)
+        {
+            src = &encoder->trailer[encoder->pos - payload_end];
+            n = payload_end + AX25_TRAILER_STR_LEN - 1 - encoder->pos;
+        }
+        else
+        {
+            if (encoder->flushed)
+            {
+                break;
+            }
+
+            encoder->spill_len = ax25_stuffer_flush(&encoder->stuffer, encoder->spill);
+            encoder->spill_pos = 0;
+            encoder->flushed = 1;
+
+            continue;
+        }
+
+        // k input bytes give at most 1.2*k + 1 output bytes, so up to 0.8*space - 1 bytes are stuffed in place
+        max_n = ((int32_t)(len - out_len)*4)/5 - 1;
+
+        if (max_n >= 1)
+        {
+            if (n > max_n)
+            {
+                n = max_n;
+            }
+
+            out_len += ax25_stuffer_push(&encoder->stuffer, src, n, &data[out_len]);
+        }
+        else
+        {
+            n = 1;
+
+            encoder->spill_len = ax25_stuffer_push(&encoder->stuffer, src, 1, encoder->spill);
+            encoder->spill_pos = 0;
+        }
+
+        encoder->pos += n;
+    }
+
+    if (encoder->g3ruh)
+    {
+        ax25_g3ruh_encode(encoder->g3ruh, data, out_len);
+    }
+
+    return out_len;
+}
+
+void ax25_encoder_set_g3ruh(AX25_Encoder *encoder, AX25_G3RUH *g3ruh)
+{
+    encoder->g3ruh = g3ruh;
+}
+
+void ax25_g3ruh_init(AX25_G3RUH *g3ruh)
+{
+    g3ruh->line[0]  = 0;
+    g3ruh->line[1]  = 0;
+    g3ruh->line[2]  = 0;
+    g3ruh->level    = 0;
+}
+
+/*
+ * The taps (12 and 17 bits back) are at least 8 bits back, so the feedback of a whole byte only depends on
+ * the previous 3 line bytes: with H = line[2]:line[1]:line[0], the taps of the 8 bits are (H >> 4) and (H >> 9).
+ */
+#define AX25_G3RUH_TAPS(l0, l1, l2)     ((uint8_t)((((uint16_t)(l1) << 8) | (l0)) >> 4) ^ (uint8_t)((((uint16_t)(l2) << 8) | (l1)) >> 1))
+
+void ax25_g3ruh_encode(AX25_G3RUH *g3ruh, uint8_t *data, uint16_t len)
+{
+    uint8_t l0 = g3ruh->line[0];
+    uint8_t l1 = g3ruh->line[1];
+    uint8_t l2 = g3ruh->line[2];
+    uint8_t level = g3ruh->level;
     uint16_t i = 0;
-    for(i=0; i<pkt_len; i++)
+
+    for(i=0; i<len; i++)
     {
-        bit_pkt[bit_pkt_counter++].val = (pkt[i] & 0x01) == 0x01? 1:0;
-        bit_pkt[bit_pkt_counter++].val = (pkt[i] & 0x02) == 0x02? 1:0;
-        bit_pkt[bit_pkt_counter++].val = (pkt[i] & 0x04) == 0x04? 1:0;
-        bit_pkt[bit_pkt_counter++].val = (pkt[i] & 0x08) == 0x08? 1:0;
-        bit_pkt[bit_pkt_counter++].val = (pkt[i] & 0x10) == 0x10? 1:0;
-        bit_pkt[bit_pkt_counter++].val = (pkt[i] & 0x20) == 0x20? 1:0;
-        bit_pkt[bit_pkt_counter++].val = (pkt[i] & 0x40) == 0x40? 1:0;
-        bit_pkt[bit_pkt_counter++].val = (pkt[i] & 0x80) == 0x80? 1:0;
+        // NRZI ("0" = transition), from the level of the last bit
+        uint8_t x = ax25_nrzi_table[data[i]] ^ (uint8_t)(-level);
+
+        level = x & 0x01;
+
+        // Scrambler: y[n] = x[n] ^ y[n-12] ^ y[n-17]
+        x ^= AX25_G3RUH_TAPS(l0, l1, l2);
+
+        l2 = l1;
+        l1 = l0;
+        l0 = x;
+
+        data[i] = x;
     }
-    
-    // STEP 2: Bit stuffing
-    bit bit_pkt_new[8*(21+256)+50];
-    uint16_t bit_pkt_new_counter = 0;
-    
-    bit bit_buffer[5];
-    uint8_t bit_buffer_counter = 0;
-    for(i=0; i<bit_pkt_counter; i++)
+
+    g3ruh->line[0]  = l0;
+    g3ruh->line[1]  = l1;
+    g3ruh->line[2]  = l2;
+    g3ruh->level    = level;
+}
+
+void ax25_g3ruh_decode(AX25_G3RUH *g3ruh, uint8_t *data, uint16_t len)
+{
+    uint8_t l0 = g3ruh->line[0];
+    uint8_t l1 = g3ruh->line[1];
+    uint8_t l2 = g3ruh->line[2];
+    uint8_t level = g3ruh->level;
+    uint16_t i = 0;
+
+    for(i=0; i<len; i++)
+    {
+        // Descrambler: x[n] = y[n] ^ y[n-12] ^ y[n-17]
+        uint8_t x = data[i] ^ AX25_G3RUH_TAPS(l0, l1, l2);
+
+        l2 = l1;
+        l1 = l0;
+        l0 = data[i];
+
+        // NRZI: "1" where the level does not change
+        data[i] = ~(x ^ ((x >> 1) | (level << 7)));
+
+        level = x & 0x01;
+    }
+
+    g3ruh->line[0]  = l0;
+    g3ruh->line[1]  = l1;
+    g3ruh->line[2]  = l2;
+    g3ruh->level    = level;
+}
+
+uint16_t ax25_fcs_update(uint16_t fcs, const uint8_t *data, uint16_t len)
+{
+    return crc_update(&crc16_x25, fcs, data, len);
+}
+
+void ax25_decoder_init(AX25_Decoder *decoder)
+{
+    decoder->len        = 0;
+    decoder->fcs        = AX25_FCS_INIT;
+    decoder->byte       = 0;
+    decoder->bits       = 0;
+    decoder->ones       = 0;
+    decoder->in_frame   = 0;
+}
+
+uint8_t ax25_str_2_pkt(const uint8_t *str, uint16_t len, AX25_Packet *ax25_packet)
+{
+    uint16_t pos = 2*AX25_ADR_LEN;
+    uint16_t i = 0;
+
+    if (len < AX25_FRAME_MIN_LEN)
+    {
+        return AX25_DECODE_FAIL;
+    }
+
+    // The extension bit (LSB) is set only in the last byte of the address field
+    for(i=0; i<2*AX25_ADR_LEN-1; i++)
+    {
+        if (str[i] & 0x01)
+        {
+            return AX25_DECODE_FAIL;
+        }
+    }
+
+    // Repeater addresses
+    while(!(str[pos-1] & 0x01))
     {
-        bit_buffer[bit_buffer_counter++].val = bit_pkt[i].val;
-        bit_pkt_new[bit_pkt_new_counter++].val = bit_pkt[i].val;
-        
-        if (bit_buffer_counter == 5)
+        pos += AX25_ADR_LEN;
+
+        if ((pos > (2 + AX25_MAX_REPEATERS)*AX25_ADR_LEN) || (pos + 1 + 2 > len))
         {
-            if (bit_buffer[0].val & bit_buffer[1].val & bit_buffer[2].val & bit_buffer[3].val & bit_buffer[4].val)
+            return AX25_DECODE_FAIL;
+        }
+    }
+
+    for(i=0; i<AX25_ADR_LEN-1; i++)
+    {
+        ax25_packet->dst_adr.callsign[i] = str[i];
+        ax25_packet->src_adr.callsign[i] = str[AX25_ADR_LEN+i];
+    }
+
+    ax25_packet->dst_adr.callsign[AX25_ADR_LEN-1]   = 0;
+    ax25_packet->src_adr.callsign[AX25_ADR_LEN-1]   = 0;
+    ax25_packet->dst_adr.ssid                       = str[AX25_ADR_LEN-1];
+    ax25_packet->src_adr.ssid                       = str[2*AX25_ADR_LEN-1];
+
+    ax25_packet->start_flag     = AX25_FLAG;
+    ax25_packet->control_bits   = str[pos++];
+    ax25_packet->protocol_id    = 0;
+
+    if (ax25_has_pid(ax25_packet->control_bits))
+    {
+        if (pos + 2 > len - 1)
+        {
+            return AX25_DECODE_FAIL;
+        }
+
+        ax25_packet->protocol_id = str[pos++];
+    }
+
+    if (len - 2 - pos > sizeof(ax25_packet->payload.data))
+    {
+        return AX25_DECODE_FAIL;
+    }
+
+    ax25_packet->payload.len = len - 2 - pos;
+    for(i=0; i<ax25_packet->payload.len; i++)
+    {
+        ax25_packet->payload.data[i] = str[pos+i];
+    }
+
+    ax25_packet->fcs        = ((uint16_t)str[len-1] << 8) | str[len-2];     // Transmitted LSB first
+    ax25_packet->end_flag   = AX25_FLAG;
+
+    return AX25_DECODE_OK;
+}
+
+uint8_t ax25_decode(AX25_Decoder *decoder, uint8_t byte, AX25_Packet *ax25_packet)
+{
+    uint8_t state = AX25_DECODE_PREFAIL;
+    uint8_t i = 0;
+
+    for(i=0; i<8; i++, byte <<= 1)
+    {
+        if (byte & 0x80)
+        {
+            if (++decoder->ones > 6)
             {
-                bit_pkt_new[bit_pkt_new_counter++].val = 0;
-                bit_buffer_counter = 0;
+                decoder->in_frame = 0;          // Abort sequence (7 or more "1" bits)
+
+                continue;
             }
-            else
+        }
+        else
+        {
+            if (decoder->ones == 5)
+            {
+                decoder->ones = 0;              // Stuffed "0" bit
+
+                continue;
+            }
+
+            if (decoder->ones == 6)
+            {
+                decoder->ones = 0;
+
+                // Flag: the 7 previous bits of it were taken as data, so a frame that ends in a byte boundary has 7 bits left
+                if (decoder->in_frame && (decoder->bits == 7) && (decoder->len >= AX25_FRAME_MIN_LEN))
+                {
+                    if ((decoder->fcs == AX25_FCS_GOOD) && (ax25_str_2_pkt(decoder->frame, decoder->len, ax25_packet) == AX25_DECODE_OK))
+                    {
+                        state = AX25_DECODE_OK;
+                    }
+                    else
+                    {
+                        state = AX25_DECODE_FAIL;
+                    }
+                }
+
+                // The flag also starts the next frame
+                decoder->in_frame   = 1;
+                decoder->len        = 0;
+                decoder->bits       = 0;
+                decoder->fcs        = AX25_FCS_INIT;
+
+                continue;
+            }
+
+            decoder->ones = 0;
+        }
+
+        if (!decoder->in_frame)
+        {
+            continue;
+        }
+
+        decoder->byte = (decoder->byte >> 1) | (byte & 0x80);
+
+        if (++decoder->bits == 8)
+        {
+            if (decoder->len == AX25_FRAME_MAX_LEN)
             {
-                bit_buffer[0] = bit_buffer[1];
-                bit_buffer[1] = bit_buffer[2];
-                bit_buffer[2] = bit_buffer[3];
-                bit_buffer[3] = bit_buffer[4];
-                bit_buffer_counter--;
+                decoder->in_frame = 0;          // Too long, waits the next flag
+
+                continue;
             }
+
+            decoder->frame[decoder->len++] = decoder->byte;
+            decoder->fcs = (decoder->fcs >> 8) ^ crc16_ccitt_reflected_table[0][(uint8_t)decoder->fcs ^ decoder->byte];
+            decoder->bits = 0;
         }
     }
-    
-    // STEP 3: Bit packet to byte packet
-    bit byte_buffer[8];
-    uint8_t byte_buffer_counter = 0;
-    *new_pkt_len = 0;
-    
-    for(i=0; i<bit_pkt_new_counter; i++)
+
+    return state;
+}
+
+/**
+ * \brief Initializes the encoder of the current segment of a segmenter.
+ * 
+ * \param segmenter is the segmenter state.
+ * 
+ * \return The length of the encoded frame (in bytes).
+ */
+static uint16_t ax25_segmenter_start(AX25_Segmenter *segmenter)
+{
+    AX25_Encoder *encoder = &segmenter->encoder;
+    uint16_t len = AX25_SEG_DATA_LEN;
+    uint16_t header_bits = 0;
+    uint16_t fcs = AX25_FCS_INIT;
+    uint8_t ones = 0;
+    uint8_t i = 0;
+
+    encoder->header[0] = AX25_FLAG;
+
+    for(i=0; i<AX25_HEADER_LEN-1; i++)
+    {
+        encoder->header[1+i] = ax25_beacon_header[i];
+    }
+
+    encoder->header[AX25_HEADER_STR_LEN-1]  = AX25_PID_SEGMENTATION_FRAGMENT;
+    encoder->header[AX25_HEADER_STR_LEN]    = (segmenter->segments - 1 - segmenter->current) & AX25_SEG_REMAINING_MASK;
+    encoder->header_len                     = AX25_HEADER_STR_LEN + 1;
+
+    // The first segment carries the PID of the block
+    if (segmenter->current == 0)
+    {
+        encoder->header[AX25_HEADER_STR_LEN]    |= AX25_SEG_FIRST;
+        encoder->header[AX25_HEADER_STR_LEN+1]  = segmenter->pid;
+        encoder->header_len                     = AX25_HEADER_STR_LEN + 2;
+
+        len = AX25_SEG_FIRST_DATA_LEN;
+    }
+
+    if (len > segmenter->len - segmenter->pos)
+    {
+        len = segmenter->len - segmenter->pos;
+    }
+
+    header_bits = ax25_stuffed_bits(&encoder->header[1], encoder->header_len-1, &ones);
+
+    fcs = ax25_fcs_update(fcs, &encoder->header[1], encoder->header_len-1);
+    fcs = ax25_fcs_update(fcs, &segmenter->data[segmenter->pos], len);
+
+    len = ax25_encoder_start(encoder, &segmenter->data[segmenter->pos], len, fcs ^ 0xFFFF, header_bits, ones);
+
+    encoder->g3ruh = segmenter->g3ruh;
+
+    return len;
+}
+
+uint16_t ax25_segmenter_init(AX25_Segmenter *segmenter, const uint8_t *data, uint16_t len, uint8_t pid)
+{
+    uint16_t total = 0;
+
+    if (len > AX25_SEG_MAX_LEN)
+    {
+        return 0;
+    }
+
+    segmenter->data     = data;
+    segmenter->len      = len;
+    segmenter->pid      = pid;
+    segmenter->segments = 1;
+    segmenter->g3ruh    = NULL;
+
+    if (len > AX25_SEG_FIRST_DATA_LEN)
+    {
+        segmenter->segments += (len - AX25_SEG_FIRST_DATA_LEN + AX25_SEG_DATA_LEN - 1)/AX25_SEG_DATA_LEN;
+    }
+
+    // The radio needs the length of the whole transmission before the first byte
+    segmenter->pos = 0;
+    for(segmenter->current=0; segmenter->current<segmenter->segments; segmenter->current++)
+    {
+        total += ax25_segmenter_start(segmenter);
+        segmenter->pos += segmenter->encoder.payload_len;
+    }
+
+    segmenter->pos      = 0;
+    segmenter->current  = 0;
+
+    ax25_segmenter_start(segmenter);
+
+    return total;
+}
+
+void ax25_segmenter_set_g3ruh(AX25_Segmenter *segmenter, AX25_G3RUH *g3ruh)
+{
+    segmenter->g3ruh = g3ruh;
+
+    ax25_encoder_set_g3ruh(&segmenter->encoder, g3ruh);
+}
+
+uint16_t ax25_segmenter_read(AX25_Segmenter *segmenter, uint8_t *data, uint16_t len)
+{
+    uint16_t out_len = 0;
+
+    while(out_len < len)
     {
-        byte_buffer[byte_buffer_counter++] = bit_pkt_new[i];
-        
-        if (((bit_pkt_new_counter - i) < 8) && ((bit_pkt_new_counter % 8) != 0) && (byte_buffer_counter == 1))
+        out_len += ax25_encoder_read(&segmenter->encoder, &data[out_len], len - out_len);
+
+        if (out_len < len)
         {
-            new_pkt[*new_pkt_len] = 0x00;
-            uint8_t j = 0;
-            for(j=0; j<(bit_pkt_new_counter-i); j++)
+            // End of the current frame: the next one follows right after it
+            if (segmenter->current + 1 >= segmenter->segments)
             {
-                new_pkt[*new_pkt_len] |= (bit_pkt_new[i+j].val << (7-j));
+                break;
             }
-            
-            (*new_pkt_len)++;
-            
-            break;
+
+            segmenter->pos += segmenter->encoder.payload_len;
+            segmenter->current++;
+
+            ax25_segmenter_start(segmenter);
         }
-        
-        if (byte_buffer_counter == 8)
+    }
+
+    return out_len;
+}
+
+void ax25_reassembler_init(AX25_Reassembler *reassembler, uint8_t *data, uint16_t size)
+{
+    reassembler->data       = data;
+    reassembler->size       = size;
+    reassembler->len        = 0;
+    reassembler->pid        = 0;
+    reassembler->remaining  = 0;
+    reassembler->active     = 0;
+}
+
+uint8_t ax25_reassemble(AX25_Reassembler *reassembler, const AX25_Packet *ax25_packet)
+{
+    const uint8_t *src = ax25_packet->payload.data;
+    uint16_t len = ax25_packet->payload.len;
+    uint16_t i = 0;
+
+    if (ax25_packet->protocol_id != AX25_PID_SEGMENTATION_FRAGMENT)
+    {
+        // A complete block in a single packet
+        if (len > reassembler->size)
         {
-            new_pkt[(*new_pkt_len)++] = (byte_buffer[0].val << 7) | (byte_buffer[1].val << 6) | (byte_buffer[2].val << 5) |
-                                        (byte_buffer[3].val << 4) | (byte_buffer[4].val << 3) | (byte_buffer[5].val << 2) |
-                                        (byte_buffer[6].val << 1) | byte_buffer[7].val;
-            byte_buffer_counter = 0;
+            reassembler->active = 0;
+
+            return AX25_DECODE_FAIL;
         }
+
+        reassembler->len    = 0;
+        reassembler->pid    = ax25_packet->protocol_id;
+        reassembler->active = 0;
     }
+    else
+    {
+        uint8_t seg_header = (len > 0)? src[0] : 0;
+        uint8_t seg_header_len = (seg_header & AX25_SEG_FIRST)? 2 : 1;
+
+        if (len < seg_header_len)
+        {
+            reassembler->active = 0;
+
+            return AX25_DECODE_FAIL;
+        }
+
+        if (seg_header & AX25_SEG_FIRST)
+        {
+            reassembler->len    = 0;
+            reassembler->pid    = src[1];
+            reassembler->active = 1;
+        }
+        else if (!reassembler->active || ((seg_header & AX25_SEG_REMAINING_MASK) != reassembler->remaining - 1))
+        {
+            // Lost segment: the block can not be completed
+            reassembler->active = 0;
+
+            return AX25_DECODE_FAIL;
+        }
+
+        reassembler->remaining = seg_header & AX25_SEG_REMAINING_MASK;
+
+        src += seg_header_len;
+        len -= seg_header_len;
+
+        if (len > reassembler->size - reassembler->len)
+        {
+            reassembler->active = 0;
+
+            return AX25_DECODE_FAIL;
+        }
+    }
+
+    for(i=0; i<len; i++)
+    {
+        reassembler->data[reassembler->len++] = src[i];
+    }
+
+    if (reassembler->active && (reassembler->remaining > 0))
+    {
+        return AX25_DECODE_PREFAIL;
+    }
+
+    reassembler->active = 0;
+
+    return AX25_DECODE_OK;
 }
 
 void ax25_encode(AX25_Packet *ax25_pkt, uint8_t *pkt, uint16_t *pkt_len)
 {
-    uint8_t pkt_str[256+21];
-    uint16_t pkt_str_len;
-    
-    ax25_pkt_2_str(ax25_pkt, pkt_str, &pkt_str_len);
-    
-    ax25_bit_stuffing(pkt_str, pkt_str_len, pkt, pkt_len);
+    AX25_Encoder encoder;
+
+    *pkt_len = ax25_encoder_read(&encoder, pkt, ax25_encoder_init(&encoder, ax25_pkt));
 }
 
 //! \} End of ax25 implementation group
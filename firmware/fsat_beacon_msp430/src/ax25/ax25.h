@@ -51,8 +51,8 @@
  */
 typedef struct
 {
-    uint8_t callsign[7];
-    uint8_t ssid;
+    uint8_t callsign[7];    /**< Callsign padded with spaces, shifted one bit left (the 7th byte is always zero and is not transmitted). */
+    uint8_t ssid;           /**< SSID byte (with the C/H and extension bits). */
 } AX25_Transfer_Frame_Header;
 
 /**
@@ -61,7 +61,7 @@ typedef struct
 typedef struct
 {
     uint8_t data[256];
-    uint8_t len;
+    uint16_t len;
 } AX25_Pkt_Payload;
 
 /**
@@ -80,31 +80,224 @@ typedef struct
 } AX25_Packet;
 
 /**
- * \brief A struct to hold a bit variable.
+ * \brief Number of rows of the bit stuffing table (consecutive "1" bits already sent: 0 to 4).
+ */
+#define AX25_STUFF_MAX_ONES             5
+
+/**
+ * \brief Fields of an ax25_stuffing_table entry.
  * 
- * This struct is used during the bit stuffing process.
+ * The stuffed bits of an input byte are 8 to 10 bits, in transmission order from the MSB:
+ *      - Bits 0 to 7: the last 8 output bits.
+ *      - Bits 8 and 9: the first output bits, when the byte needed stuffing (right aligned).
+ *      - Bits 10 and 11: the number of extra output bits (0 to 2).
+ *      - Bits 12 to 14: the number of consecutive "1" bits after the byte.
+ *      .
+ */
+#define AX25_STUFF_EXTRA_POS            10
+#define AX25_STUFF_ONES_POS             12
+
+/**
+ * \brief Bit stuffing lookup table, indexed by the number of consecutive "1" bits already sent and the input byte.
+ * 
+ * Generated by host/tools/ax25_tables_gen.c (src/ax25/ax25_tables.c).
+ */
+extern const uint16_t ax25_stuffing_table[AX25_STUFF_MAX_ONES][256];
+
+/**
+ * \brief FCS (CRC-16/X.25) parameters.
+ * 
+ * The FCS is computed LSB first (reflected polynomial), starting from AX25_FCS_INIT, and is inverted before
+ * transmission. The FCS computed over a received frame including its FCS field is AX25_FCS_GOOD if there are no errors.
+ * It is computed by the CRC engine (crc16_x25 in src/crc/crc.h).
+ */
+#define AX25_FCS_POLY                   0x8408      /**< x^16 + x^12 + x^5 + 1, reflected. */
+#define AX25_FCS_INIT                   0xFFFF      /**< Initial value. */
+#define AX25_FCS_GOOD                   0xF0B8      /**< Residue of a valid frame. */
+
+/**
+ * \brief Length of an address subfield in a frame (callsign and SSID).
+ */
+#define AX25_ADR_LEN                    7
+
+/**
+ * \brief Maximum number of repeater addresses in a received frame.
+ */
+#define AX25_MAX_REPEATERS              2
+
+/**
+ * \brief Length limits of a received frame (between flags, FCS included).
+ */
+#define AX25_FRAME_MIN_LEN              (2*AX25_ADR_LEN + 1 + 2)
+#define AX25_FRAME_MAX_LEN              ((2 + AX25_MAX_REPEATERS)*AX25_ADR_LEN + 2 + 256 + 2)
+
+/**
+ * \brief Decodification states.
+ */
+#define AX25_DECODE_OK                  0   /**< A valid frame was received. */
+#define AX25_DECODE_FAIL                1   /**< A frame was received with a wrong FCS or an invalid address field. */
+#define AX25_DECODE_PREFAIL             2   /**< No frame was finished. */
+
+/**
+ * \brief HDLC deframer and decoder state.
  */
 typedef struct
 {
-    uint8_t val:1;      /**< The bit value (0 or 1). */
-} bit;
+    uint8_t frame[AX25_FRAME_MAX_LEN];  /**< Received bytes of the current frame (after the bit de-stuffing). */
+    uint16_t len;                       /**< Number of bytes in frame. */
+    uint16_t fcs;                       /**< FCS of the bytes in frame. */
+    uint8_t byte;                       /**< Byte being received (LSB first). */
+    uint8_t bits;                       /**< Number of bits in byte. */
+    uint8_t ones;                       /**< Number of consecutive "1" bits received. */
+    uint8_t in_frame;                   /**< A flag was received and the following bits are a frame. */
+} AX25_Decoder;
+
+/**
+ * \brief Bit stuffing state, to stuff a packet in parts.
+ */
+typedef struct
+{
+    uint16_t acc;       /**< Output bits not written yet (the "bits" lower bits). */
+    uint8_t bits;       /**< Number of bits in acc (0 to 7). */
+    uint8_t ones;       /**< Number of consecutive "1" bits sent. */
+} AX25_Stuffer;
+
+/**
+ * \brief Length of the address, control and PID fields of a packet (without repeaters).
+ */
+#define AX25_HEADER_LEN                 (2*AX25_ADR_LEN + 2)
+
+/**
+ * \brief Length of the header of a packet as a string of bytes (flag, addresses, control and PID fields).
+ */
+#define AX25_HEADER_STR_LEN             (1 + AX25_HEADER_LEN)
+
+/**
+ * \brief Length of the end of a packet as a string of bytes (FCS and flag).
+ */
+#define AX25_TRAILER_STR_LEN            3
+
+/**
+ * \brief Segmentation (AX.25 2.2, section 6.6).
+ * 
+ * A block longer than one information field is sent in UI frames with the PID AX25_PID_SEGMENTATION_FRAGMENT.
+ * The information field of each frame starts with a segment header byte (the first segment flag and the number of
+ * segments after this one), followed, in the first segment only, by the PID of the block, and then by the data.
+ */
+#define AX25_SEG_FIRST                  0x80        /**< First segment flag of the segment header. */
+#define AX25_SEG_REMAINING_MASK         0x7F        /**< Number of segments after this one. */
+#define AX25_SEG_MAX_SEGMENTS           128         /**< Maximum number of segments of a block. */
+#define AX25_SEG_FIRST_DATA_LEN         (256 - 2)   /**< Data bytes of the first segment. */
+#define AX25_SEG_DATA_LEN               (256 - 1)   /**< Data bytes of the other segments. */
+#define AX25_SEG_MAX_LEN                (AX25_SEG_FIRST_DATA_LEN + (AX25_SEG_MAX_SEGMENTS - 1)*AX25_SEG_DATA_LEN)   /**< Maximum length of a block. */
+
+/**
+ * \brief NRZI lookup table: the line levels (MSB first) of a byte, starting from the level 0.
+ * 
+ * Generated by host/tools/ax25_tables_gen.c (src/ax25/ax25_tables.c).
+ */
+extern const uint8_t ax25_nrzi_table[256];
+
+/**
+ * \brief NRZI and G3RUH (1 + x^12 + x^17) scrambler state of a 9600 bps line, for one direction.
+ * 
+ * The scrambler is self-synchronizing: a descrambler with any initial state gives the right bits after 17 line bits.
+ */
+typedef struct
+{
+    uint8_t line[3];                        /**< Last 24 line bits (scrambler output or descrambler input), the newest in line[0]. */
+    uint8_t level;                          /**< NRZI level of the last bit (0 or 1). */
+} AX25_G3RUH;
+
+/**
+ * \brief Streaming encoder state.
+ * 
+ * Gives the encoded (bit stuffed) packet in parts, on demand, without a copy of the entire packet.
+ */
+typedef struct
+{
+    uint8_t header[AX25_HEADER_STR_LEN+2];  /**< Header of the packet, as a string of bytes (with the segment header and PID in segments). */
+    uint8_t header_len;                     /**< Length of header. */
+    uint8_t trailer[AX25_TRAILER_STR_LEN];  /**< End of the packet, as a string of bytes. */
+    const uint8_t *payload;                 /**< Payload of the packet (not copied). */
+    uint16_t payload_len;                   /**< Length of the payload. */
+    uint16_t pos;                           /**< Next byte of the packet to encode (before the bit stuffing). */
+    uint16_t len;                           /**< Length of the encoded packet. */
+    AX25_Stuffer stuffer;                   /**< Bit stuffing state. */
+    uint8_t spill[2];                       /**< Encoded bytes that did not fit in the last read. */
+    uint8_t spill_len;                      /**< Number of bytes in spill. */
+    uint8_t spill_pos;                      /**< Next byte of spill to read. */
+    uint8_t flushed;                        /**< The last incomplete byte was already written to spill. */
+    AX25_G3RUH *g3ruh;                      /**< Line coding of the output (NULL = none). */
+} AX25_Encoder;
+
+/**
+ * \brief Segmenter state: gives the encoded frames of a block, back to back, as a single stream.
+ */
+typedef struct
+{
+    AX25_Encoder encoder;                   /**< Encoder of the current segment. */
+    const uint8_t *data;                    /**< Block to send (not copied). */
+    uint16_t len;                           /**< Length of the block. */
+    uint16_t pos;                           /**< Start of the current segment in data. */
+    uint8_t pid;                            /**< PID of the block. */
+    uint8_t segments;                       /**< Number of segments of the block. */
+    uint8_t current;                        /**< Index of the current segment. */
+    AX25_G3RUH *g3ruh;                      /**< Line coding of the output (NULL = none). */
+} AX25_Segmenter;
+
+/**
+ * \brief Reassembler state, to rebuild a segmented block from the received frames.
+ */
+typedef struct
+{
+    uint8_t *data;                          /**< Array to store the block. */
+    uint16_t size;                          /**< Size of data. */
+    uint16_t len;                           /**< Number of bytes in data. */
+    uint8_t pid;                            /**< PID of the block. */
+    uint8_t remaining;                      /**< Number of segments still expected. */
+    uint8_t active;                         /**< The first segment was received and the block is not complete. */
+} AX25_Reassembler;
+
+/**
+ * \brief Fills an address subfield (callsign padded with spaces, shifted one bit left).
+ * 
+ * \param adr is the address subfield.
+ * \param callsign is the callsign string (up to 6 characters).
+ * \param ssid is the SSID byte (with the C/H and extension bits).
+ * 
+ * \return None.
+ */
+void ax25_set_address(AX25_Transfer_Frame_Header *adr, const char *callsign, uint8_t ssid);
+
+/**
+ * \brief AX25 initialization.
+ * 
+ * Builds the beacon header template (the fields listed in ax25_beacon_pkt_gen), with its FCS state and its
+ * length after the bit stuffing, so the beacon packets only process the payload.
+ * 
+ * \return None.
+ */
+void ax25_init();
 
 /**
  * \brief Generates the packet with a initial data.
  * 
  * The header of the Beacon AX25 packet is defined with following configuration:
  *      - AX25_FLAG
- *      - AX25_FLORIPASAT_CALLSIGN << 1
+ *      - AX25_DESTINATION_CALLSIGN << 1 (padded with spaces to 6 characters)
  *      - AX25_ADR_NON_REPEATER_SSID | (AX25_FLORIPASAT_GRS_SSID << 1) | AX25_ADR_DST_COMMAND
- *      - AX25_FLORIPASAT_CALLSIGN << 1
- *      - AX25_ADR_NON_REPEATER_SSID | (AX25_FLORIPASAT_SAT_SSID << 1) | AX25_ADR_SRC_COMMAND
+ *      - AX25_FLORIPASAT_CALLSIGN << 1 (padded with spaces to 6 characters)
+ *      - AX25_ADR_NON_REPEATER_SSID | (AX25_FLORIPASAT_SAT_SSID << 1) | AX25_ADR_SRC_COMMAND | AX25_ADR_LAST_ADDRESS
  *      - AX25_CTRL_UNNUMBERED_UI | AX25_CTRL_PF_DISABLE
  *      - AX25_PID_NO_LAYER_3
  *      - Data
- *      - FCS (crc16 over the data field)
+ *      - FCS (CRC-16/X.25 over the address, control, PID and data fields, transmitted LSB first)
  *      - AX25_FLAG
  *      .
  * 
+ * The header is copied from the template built by ax25_init.
+ * 
  * \param ax25_packet is the struct with an entire packet.
  * \param data is data to be transmitted at the data field of the packet.
  * \param data_size is size of the data to be transmitted at the data field of the packet.
@@ -122,7 +315,7 @@ void ax25_beacon_pkt_gen(AX25_Packet *ax25_packet, uint8_t *data, uint16_t data_
  * 
  * \return None.
  */
-void ax25_update_data_from_pkt(AX25_Packet *ax25_packet, uint8_t *new_data, uint16_t new_data_size);
+void ax25_update_data_from_pkt(AX25_Packet *ax25_packet, const uint8_t *new_data, uint16_t new_data_size);
 
 /**
  * \brief Converts a packet in a struct, to an array (string) of bytes.
@@ -154,6 +347,240 @@ void ax25_pkt_2_str(AX25_Packet *ax25_packet, uint8_t *str_pkt, uint16_t *str_pk
  */
 void ax25_bit_stuffing(uint8_t *pkt, uint16_t pkt_len, uint8_t *new_pkt, uint16_t *new_pkt_len);
 
+/**
+ * \brief Initializes a bit stuffing state.
+ * 
+ * \param stuffer is the bit stuffing state.
+ * 
+ * \return None.
+ */
+void ax25_stuffer_init(AX25_Stuffer *stuffer);
+
+/**
+ * \brief Applies bit stuffing to a part of a packet.
+ * 
+ * The bits are taken LSB first from each input byte and written MSB first to the output bytes.
+ * 
+ * \param stuffer is the bit stuffing state.
+ * \param data is the input bytes.
+ * \param len is the number of input bytes.
+ * \param out is the array to store the stuffed bytes (len + len/4 + 1 bytes at most).
+ * 
+ * \return The number of bytes written to out.
+ */
+uint16_t ax25_stuffer_push(AX25_Stuffer *stuffer, const uint8_t *data, uint16_t len, uint8_t *out);
+
+/**
+ * \brief Writes a flag (without bit stuffing) after the bits already stuffed.
+ * 
+ * \param stuffer is the bit stuffing state.
+ * \param out is the array to store the output byte.
+ * 
+ * \return The number of bytes written to out (always 1).
+ */
+uint8_t ax25_stuffer_flag(AX25_Stuffer *stuffer, uint8_t *out);
+
+/**
+ * \brief Writes the last incomplete byte of a stuffed packet (the remaining bits MSB aligned, padded with zeros).
+ * 
+ * \param stuffer is the bit stuffing state.
+ * \param out is the array to store the last byte.
+ * 
+ * \return The number of bytes written to out (0 or 1).
+ */
+uint8_t ax25_stuffer_flush(AX25_Stuffer *stuffer, uint8_t *out);
+
+/**
+ * \brief Initializes a streaming encoder with a pre-generated AX25 packet.
+ * 
+ * The payload of the packet is not copied, so ax25_packet must be kept until the end of the encoding.
+ * 
+ * \param encoder is the encoder state.
+ * \param ax25_packet is the packet to encode.
+ * 
+ * \return The length of the encoded packet (in bytes).
+ */
+uint16_t ax25_encoder_init(AX25_Encoder *encoder, const AX25_Packet *ax25_packet);
+
+/**
+ * \brief Initializes a streaming encoder with a beacon packet, directly from its payload.
+ * 
+ * The same as ax25_beacon_pkt_gen followed by ax25_encoder_init, without the packet struct: the header comes from
+ * the template built by ax25_init, and the payload is not copied (it must be kept until the end of the encoding).
+ * 
+ * \param encoder is the encoder state.
+ * \param data is the payload of the packet.
+ * \param data_size is the length of the payload (up to 256 bytes).
+ * 
+ * \return The length of the encoded packet (in bytes).
+ */
+uint16_t ax25_beacon_encoder_init(AX25_Encoder *encoder, const uint8_t *data, uint16_t data_size);
+
+/**
+ * \brief Reads the next part of the encoded packet.
+ * 
+ * The concatenation of all the parts is equal to the output of ax25_encode.
+ * 
+ * \param encoder is the encoder state.
+ * \param data is the array to store the encoded bytes.
+ * \param len is the maximum number of bytes to read.
+ * 
+ * \return The number of bytes stored in data (less than len only at the end of the packet).
+ */
+uint16_t ax25_encoder_read(AX25_Encoder *encoder, uint8_t *data, uint16_t len);
+
+/**
+ * \brief Updates a FCS (CRC-16/X.25) with a sequence of bytes.
+ * 
+ * \param fcs is the current FCS value (AX25_FCS_INIT at the start of the frame).
+ * \param data is the bytes.
+ * \param len is the number of bytes.
+ * 
+ * \return The updated FCS value (not inverted).
+ */
+uint16_t ax25_fcs_update(uint16_t fcs, const uint8_t *data, uint16_t len);
+
+/**
+ * \brief Initializes a decoder state.
+ * 
+ * \param decoder is the decoder state.
+ * 
+ * \return None.
+ */
+void ax25_decoder_init(AX25_Decoder *decoder);
+
+/**
+ * \brief Converts a received frame (between flags, FCS included) to a packet struct.
+ * 
+ * Repeater addresses are skipped, and the PID field is only read from I and UI frames (0 otherwise).
+ * The callsign fields get the 6 callsign bytes (shifted one bit left) and a trailing zero.
+ * 
+ * \param str is the frame.
+ * \param len is the length of the frame.
+ * \param ax25_packet is the struct to store the packet.
+ * 
+ * \return AX25_DECODE_OK, or AX25_DECODE_FAIL if the address field is invalid.
+ */
+uint8_t ax25_str_2_pkt(const uint8_t *str, uint16_t len, AX25_Packet *ax25_packet);
+
+/**
+ * \brief Packet decoding (HDLC flag detection, bit de-stuffing, FCS verification and fields parsing).
+ * 
+ * The received bits are passed one byte at a time, MSB first (the order of transmission of ax25_encode).
+ * 
+ * \param decoder is the decoder state.
+ * \param byte is the received byte.
+ * \param ax25_packet is the struct to store the decoded packet.
+ * 
+ * \return The decodification state (AX25_DECODE_PREFAIL if no frame was finished).
+ */
+uint8_t ax25_decode(AX25_Decoder *decoder, uint8_t byte, AX25_Packet *ax25_packet);
+
+/**
+ * \brief Applies NRZI and G3RUH scrambling to the output of a streaming encoder.
+ * 
+ * The line state is kept by the caller, so consecutive packets form a continuous line signal.
+ * 
+ * \param encoder is an initialized encoder state.
+ * \param g3ruh is the line state of the transmitter (initialized by ax25_g3ruh_init).
+ * 
+ * \return None.
+ */
+void ax25_encoder_set_g3ruh(AX25_Encoder *encoder, AX25_G3RUH *g3ruh);
+
+/**
+ * \brief Initializes a NRZI and G3RUH scrambler state.
+ * 
+ * \param g3ruh is the line state.
+ * 
+ * \return None.
+ */
+void ax25_g3ruh_init(AX25_G3RUH *g3ruh);
+
+/**
+ * \brief NRZI encodes and scrambles bit stuffed bytes (MSB first), in place.
+ * 
+ * \param g3ruh is the line state of the transmitter.
+ * \param data is the bytes to encode.
+ * \param len is the number of bytes.
+ * 
+ * \return None.
+ */
+void ax25_g3ruh_encode(AX25_G3RUH *g3ruh, uint8_t *data, uint16_t len);
+
+/**
+ * \brief Descrambles and NRZI decodes received line bytes (MSB first), in place, before ax25_decode.
+ * 
+ * \param g3ruh is the line state of the receiver.
+ * \param data is the bytes to decode.
+ * \param len is the number of bytes.
+ * 
+ * \return None.
+ */
+void ax25_g3ruh_decode(AX25_G3RUH *g3ruh, uint8_t *data, uint16_t len);
+
+/**
+ * \brief Initializes a segmenter with a block of data.
+ * 
+ * The block is split in AX25_SEG_FIRST_DATA_LEN and AX25_SEG_DATA_LEN bytes segments, each one sent in a UI frame
+ * with the beacon header (ax25_init) and the PID AX25_PID_SEGMENTATION_FRAGMENT. The block is not copied, so it
+ * must be kept until the end of the encoding.
+ * 
+ * \param segmenter is the segmenter state.
+ * \param data is the block.
+ * \param len is the length of the block (up to AX25_SEG_MAX_LEN bytes).
+ * \param pid is the PID of the block (AX25_PID_NO_LAYER_3 for telemetry).
+ * 
+ * \return The length of all the encoded frames (in bytes), or 0 if the block is too long.
+ */
+uint16_t ax25_segmenter_init(AX25_Segmenter *segmenter, const uint8_t *data, uint16_t len, uint8_t pid);
+
+/**
+ * \brief Applies NRZI and G3RUH scrambling to the output of a segmenter.
+ * 
+ * \param segmenter is an initialized segmenter state.
+ * \param g3ruh is the line state of the transmitter (initialized by ax25_g3ruh_init).
+ * 
+ * \return None.
+ */
+void ax25_segmenter_set_g3ruh(AX25_Segmenter *segmenter, AX25_G3RUH *g3ruh);
+
+/**
+ * \brief Reads the next part of the encoded frames of a block.
+ * 
+ * \param segmenter is the segmenter state.
+ * \param data is the array to store the encoded bytes.
+ * \param len is the maximum number of bytes to read.
+ * 
+ * \return The number of bytes stored in data (less than len only at the end of the last frame).
+ */
+uint16_t ax25_segmenter_read(AX25_Segmenter *segmenter, uint8_t *data, uint16_t len);
+
+/**
+ * \brief Initializes a reassembler state.
+ * 
+ * \param reassembler is the reassembler state.
+ * \param data is the array to store the reassembled blocks.
+ * \param size is the size of data (AX25_SEG_MAX_LEN bytes for any block).
+ * 
+ * \return None.
+ */
+void ax25_reassembler_init(AX25_Reassembler *reassembler, uint8_t *data, uint16_t size);
+
+/**
+ * \brief Adds a received packet to a reassembler.
+ * 
+ * A packet without segmentation is a complete block by itself. Both it and a first segment discard any incomplete block.
+ * 
+ * \param reassembler is the reassembler state.
+ * \param ax25_packet is the received packet.
+ * 
+ * \return AX25_DECODE_OK if a block is complete (in reassembler->data, with reassembler->len bytes and the PID
+ *         reassembler->pid), AX25_DECODE_FAIL if a segment is missing, out of order or does not fit in data
+ *         (the block is discarded), or AX25_DECODE_PREFAIL if more segments are expected.
+ */
+uint8_t ax25_reassemble(AX25_Reassembler *reassembler, const AX25_Packet *ax25_packet);
+
 /**
  * \brief Encodes a pre-generated AX25 packet to a ready-to-transmit format.
  * 
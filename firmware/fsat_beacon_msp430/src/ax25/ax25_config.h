@@ -48,6 +48,13 @@
 
 #define AX25_DESTINATION_CALLSIGN       BEACON_PACKET_DST_CALLSIGN      /**< Destination callsign. */
 
+#define AX25_G3RUH_ENABLED              0                               /**< If 1, the AX.25 packets are sent NRZI coded and G3RUH scrambled (9600 bps modems). */
+
+#define AX25_LINK_N1                    128                             /**< Maximum length of the information field of the connected mode I frames. */
+#define AX25_LINK_WINDOW                4                               /**< Default window size (k) of the connected mode (1 to AX25_LINK_WINDOW_MAX). */
+#define AX25_LINK_T1                    30                              /**< Acknowledgement timer (T1) of the connected mode, in ax25_link_tick periods. */
+#define AX25_LINK_N2                    10                              /**< Maximum number of retries of the connected mode. */
+
 #endif // AX25_CONFIG_H_
 
 //! \} End of ax25_config group
@@ -73,6 +73,7 @@
 #define AX25_ADR_DST_RESPONSE                       0x00    /**< Destination SSID C-Bit as response frame. */
 #define AX25_ADR_SRC_COMMAND                        0x00    /**< Source SSID C-Bit as command frame. */
 #define AX25_ADR_SRC_RESPONSE                       0x80    /**< Source SSID C-Bit as response frame. */
+#define AX25_ADR_LAST_ADDRESS                       0x01    /**< Extension bit of the SSID of the last address subfield. */
 
 /*
  * \brief Control Fields.
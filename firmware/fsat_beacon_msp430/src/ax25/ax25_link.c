@@ -0,0 +1,549 @@
+/*
+ * ax25_link.c
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina.
+ * 
+ * This file is part of FloripaSat-Beacon.
+ * 
+ * FloripaSat-Beacon is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-Beacon is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-Beacon. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+ 
+/**
+ * \brief AX25 connected mode implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup ax25_link
+ * \{
+ */
+
+#include "ax25_link.h"
+
+#define AX25_LINK_SEQ_MASK              (AX25_LINK_MODULUS - 1)
+
+#define AX25_LINK_CTRL_NR(ctrl)         (((ctrl) >> 5) & AX25_LINK_SEQ_MASK)    /**< N(R) of an I or S frame. */
+#define AX25_LINK_CTRL_NS(ctrl)         (((ctrl) >> 1) & AX25_LINK_SEQ_MASK)    /**< N(S) of an I frame. */
+
+/**
+ * \brief Sends a frame to the remote station.
+ * 
+ * \param link is the data link state.
+ * \param control is the control field.
+ * \param command is 1 for a command frame, 0 for a response frame.
+ * \param data is the information field (I frames only).
+ * \param len is the length of the information field.
+ * 
+ * \return None.
+ */
+static void ax25_link_send(AX25_Link *link, uint8_t control, uint8_t command, const uint8_t *data, uint16_t len)
+{
+    AX25_Packet *frame = &link->frame;
+
+    frame->start_flag   = AX25_FLAG;
+    frame->dst_adr      = link->remote;
+    frame->src_adr      = link->local;
+    frame->control_bits = control;
+    frame->protocol_id  = AX25_PID_NO_LAYER_3;
+    frame->end_flag     = AX25_FLAG;
+
+    frame->dst_adr.ssid |= command? AX25_ADR_DST_COMMAND : AX25_ADR_DST_RESPONSE;
+    frame->src_adr.ssid |= (command? AX25_ADR_SRC_COMMAND : AX25_ADR_SRC_RESPONSE) | AX25_ADR_LAST_ADDRESS;
+
+    ax25_update_data_from_pkt(frame, data, len);
+
+    link->tx(link->ctx, frame);
+}
+
+/**
+ * \brief Sends a S frame with the current V(R).
+ * 
+ * \param link is the data link state.
+ * \param type is the supervisory frame type (AX25_CTRL_SUPERVISORY_RR, RNR, REJ or SREJ).
+ * \param nr is the N(R) field.
+ * \param pf is the poll/final bit (AX25_CTRL_PF_TRUE or AX25_CTRL_PF_FALSE).
+ * 
+ * \return None.
+ */
+static void ax25_link_send_s(AX25_Link *link, uint8_t type, uint8_t nr, uint8_t pf)
+{
+    ax25_link_send(link, (nr << 5) | pf | type, 0, 0, 0);
+
+    link->ack_pending = 0;
+}
+
+/**
+ * \brief Sends a queued I frame.
+ * 
+ * \param link is the data link state.
+ * \param seq is the sequence number of the frame (not reduced modulo 8).
+ * \param pf is the poll bit (AX25_CTRL_PF_TRUE or AX25_CTRL_PF_FALSE).
+ * 
+ * \return None.
+ */
+static void ax25_link_send_i(AX25_Link *link, uint8_t seq, uint8_t pf)
+{
+    uint8_t slot = seq & AX25_LINK_SEQ_MASK;
+
+    // The N(R) acknowledges the received frames too
+    ax25_link_send(link, (link->vr << 5) | pf | (slot << 1) | AX25_CTRL_INFORMATION, 1, link->tx_data[slot], link->tx_len[slot]);
+
+    link->ack_pending = 0;
+}
+
+/**
+ * \brief Clears the sequence variables and the queues.
+ * 
+ * \param link is the data link state.
+ * 
+ * \return None.
+ */
+static void ax25_link_reset(AX25_Link *link)
+{
+    link->va            = 0;
+    link->vs            = 0;
+    link->tail          = 0;
+    link->vr            = 0;
+    link->rx_valid      = 0;
+    link->srej_sent     = 0;
+    link->ack_pending   = 0;
+    link->remote_busy   = 0;
+    link->retries       = 0;
+    link->t1            = 0;
+}
+
+/**
+ * \brief Sends the queued I frames that fit in the window.
+ * 
+ * \param link is the data link state.
+ * 
+ * \return None.
+ */
+static void ax25_link_push(AX25_Link *link)
+{
+    while((link->state == AX25_LINK_CONNECTED) && !link->remote_busy && (link->vs != link->tail) && ((uint8_t)(link->vs - link->va) < link->window))
+    {
+        // The last frame of a burst polls the remote station, to get the acknowledgement right after it
+        uint8_t last = ((uint8_t)(link->vs + 1) == link->tail) || ((uint8_t)(link->vs + 1 - link->va) == link->window);
+
+        ax25_link_send_i(link, link->vs, last? AX25_CTRL_PF_TRUE : AX25_CTRL_PF_FALSE);
+
+        link->vs++;
+
+        if (link->t1 == 0)
+        {
+            link->t1 = link->t1_init;
+        }
+    }
+}
+
+/**
+ * \brief Acknowledges the sent I frames before a N(R).
+ * 
+ * \param link is the data link state.
+ * \param nr is the received N(R).
+ * 
+ * \return 1 if the N(R) is valid (between V(A) and V(S)), 0 otherwise.
+ */
+static uint8_t ax25_link_ack(AX25_Link *link, uint8_t nr)
+{
+    uint8_t acked = (nr - link->va) & AX25_LINK_SEQ_MASK;
+
+    if (acked > (uint8_t)(link->vs - link->va))
+    {
+        return 0;
+    }
+
+    if (acked > 0)
+    {
+        link->va        += acked;
+        link->retries   = 0;
+        link->t1        = (link->va == link->vs)? 0 : link->t1_init;
+    }
+
+    return 1;
+}
+
+/**
+ * \brief Checks if two addresses are the same station (callsign and SSID).
+ * 
+ * \param a is an address.
+ * \param b is the other address.
+ * 
+ * \return 1 if the addresses are the same, 0 otherwise.
+ */
+static uint8_t ax25_link_same_address(const AX25_Transfer_Frame_Header *a, const AX25_Transfer_Frame_Header *b)
+{
+    uint8_t i = 0;
+
+    for(i=0; i<AX25_ADR_LEN-1; i++)
+    {
+        if (a->callsign[i] != b->callsign[i])
+        {
+            return 0;
+        }
+    }
+
+    return (a->ssid & 0x1E) == (b->ssid & 0x1E);
+}
+
+/**
+ * \brief Processes a received I frame.
+ * 
+ * \param link is the data link state.
+ * \param ax25_packet is the frame.
+ * 
+ * \return None.
+ */
+static void ax25_link_receive_i(AX25_Link *link, const AX25_Packet *ax25_packet)
+{
+    uint8_t ctrl = ax25_packet->control_bits;
+    uint8_t ns = AX25_LINK_CTRL_NS(ctrl);
+    uint8_t offset = (ns - link->vr) & AX25_LINK_SEQ_MASK;
+    uint8_t m = 0;
+    uint16_t i = 0;
+
+    if (!ax25_link_ack(link, AX25_LINK_CTRL_NR(ctrl)) || (ax25_packet->payload.len > AX25_LINK_N1))
+    {
+        return;
+    }
+
+    if (offset == 0)
+    {
+        link->rx(link->ctx, ax25_packet->payload.data, ax25_packet->payload.len);
+        link->srej_sent &= ~(1 << ns);
+        link->vr = (link->vr + 1) & AX25_LINK_SEQ_MASK;
+
+        // The frames already received after it
+        while(link->rx_valid & (1 << link->vr))
+        {
+            link->rx(link->ctx, link->rx_data[link->vr], link->rx_len[link->vr]);
+            link->rx_valid  &= ~(1 << link->vr);
+            link->srej_sent &= ~(1 << link->vr);
+            link->vr = (link->vr + 1) & AX25_LINK_SEQ_MASK;
+        }
+    }
+    else if (offset < link->window)
+    {
+        if (!(link->rx_valid & (1 << ns)))
+        {
+            for(i=0; i<ax25_packet->payload.len; i++)
+            {
+                link->rx_data[ns][i] = ax25_packet->payload.data[i];
+            }
+
+            link->rx_len[ns] = ax25_packet->payload.len;
+            link->rx_valid  |= 1 << ns;
+            link->srej_sent &= ~(1 << ns);
+        }
+
+        // Selective reject of each missing frame before it (only once)
+        for(m=link->vr; m!=ns; m=(m+1) & AX25_LINK_SEQ_MASK)
+        {
+            if (!((link->rx_valid | link->srej_sent) & (1 << m)))
+            {
+                ax25_link_send_s(link, AX25_CTRL_SUPERVISORY_SREJ, m, AX25_CTRL_PF_FALSE);
+
+                link->srej_sent |= 1 << m;
+            }
+        }
+    }
+
+    // In sequence frames and duplicates are acknowledged with the next RR (or right now, if polled)
+    link->ack_pending = 1;
+
+    if (ctrl & AX25_CTRL_PF_TRUE)
+    {
+        ax25_link_send_s(link, AX25_CTRL_SUPERVISORY_RR, link->vr, AX25_CTRL_PF_TRUE);
+    }
+}
+
+/**
+ * \brief Processes a received S frame.
+ * 
+ * \param link is the data link state.
+ * \param ax25_packet is the frame.
+ * \param command is 1 if the frame is a command, 0 if it is a response.
+ * 
+ * \return None.
+ */
+static void ax25_link_receive_s(AX25_Link *link, const AX25_Packet *ax25_packet, uint8_t command)
+{
+    uint8_t ctrl = ax25_packet->control_bits;
+    uint8_t nr = AX25_LINK_CTRL_NR(ctrl);
+    uint8_t offset = (nr - link->va) & AX25_LINK_SEQ_MASK;
+
+    switch(ctrl & 0x0F)
+    {
+        case AX25_CTRL_SUPERVISORY_RR:
+        case AX25_CTRL_SUPERVISORY_RNR:
+            if (ax25_link_ack(link, nr))
+            {
+                link->remote_busy = ((ctrl & 0x0F) == AX25_CTRL_SUPERVISORY_RNR);
+            }
+
+            break;
+        case AX25_CTRL_SUPERVISORY_REJ:
+            // Go back N: all the frames from N(R)
+            if (ax25_link_ack(link, nr))
+            {
+                link->retransmissions += (uint8_t)(link->vs - link->va);
+                link->remote_busy = 0;
+                link->vs = link->va;
+            }
+
+            break;
+        case AX25_CTRL_SUPERVISORY_SREJ:
+            // Only the frame N(R)
+            if (offset < (uint8_t)(link->vs - link->va))
+            {
+                ax25_link_send_i(link, link->va + offset, AX25_CTRL_PF_FALSE);
+
+                link->retransmissions++;
+            }
+
+            break;
+        default:
+            break;
+    }
+
+    if (command && (ctrl & AX25_CTRL_PF_TRUE))
+    {
+        ax25_link_send_s(link, AX25_CTRL_SUPERVISORY_RR, link->vr, AX25_CTRL_PF_TRUE);
+    }
+
+    ax25_link_push(link);
+}
+
+/**
+ * \brief Processes a received U frame.
+ * 
+ * \param link is the data link state.
+ * \param ax25_packet is the frame.
+ * \param command is 1 if the frame is a command, 0 if it is a response.
+ * 
+ * \return None.
+ */
+static void ax25_link_receive_u(AX25_Link *link, const AX25_Packet *ax25_packet, uint8_t command)
+{
+    uint8_t pf = ax25_packet->control_bits & AX25_CTRL_PF_TRUE;
+
+    switch(ax25_packet->control_bits & ~AX25_CTRL_PF_TRUE)
+    {
+        case AX25_CTRL_UNNUMBERED_SABM:
+            if (command)
+            {
+                // A new connection, or the reset of the current one
+                ax25_link_reset(link);
+                link->state = AX25_LINK_CONNECTED;
+
+                ax25_link_send(link, AX25_CTRL_UNNUMBERED_UA | pf, 0, 0, 0);
+            }
+
+            break;
+        case AX25_CTRL_UNNUMBERED_DISC:
+            if (command)
+            {
+                ax25_link_send(link, ((link->state == AX25_LINK_DISCONNECTED)? AX25_CTRL_UNNUMBERED_DM : AX25_CTRL_UNNUMBERED_UA) | pf, 0, 0, 0);
+
+                link->state = AX25_LINK_DISCONNECTED;
+                link->t1 = 0;
+            }
+
+            break;
+        case AX25_CTRL_UNNUMBERED_UA:
+            if (link->state == AX25_LINK_AWAITING_CONNECTION)
+            {
+                ax25_link_reset(link);
+                link->state = AX25_LINK_CONNECTED;
+            }
+            else if (link->state == AX25_LINK_AWAITING_RELEASE)
+            {
+                link->state = AX25_LINK_DISCONNECTED;
+                link->t1 = 0;
+            }
+
+            break;
+        case AX25_CTRL_UNNUMBERED_DM:
+            link->state = AX25_LINK_DISCONNECTED;
+            link->t1 = 0;
+
+            break;
+        default:
+            break;
+    }
+}
+
+void ax25_link_init(AX25_Link *link, const char *local_callsign, uint8_t local_ssid, const char *remote_callsign, uint8_t remote_ssid,
+                    uint8_t window, ax25_link_tx tx, ax25_link_rx rx, void *ctx)
+{
+    ax25_set_address(&link->local, local_callsign, AX25_ADR_NON_REPEATER_SSID | (uint8_t)((local_ssid & 0x0F) << 1));
+    ax25_set_address(&link->remote, remote_callsign, AX25_ADR_NON_REPEATER_SSID | (uint8_t)((remote_ssid & 0x0F) << 1));
+
+    if ((window == 0) || (window > AX25_LINK_WINDOW_MAX))
+    {
+        window = AX25_LINK_WINDOW;
+    }
+
+    link->state             = AX25_LINK_DISCONNECTED;
+    link->window            = window;
+    link->t1_init           = AX25_LINK_T1;
+    link->retransmissions   = 0;
+    link->tx                = tx;
+    link->rx                = rx;
+    link->ctx               = ctx;
+
+    ax25_link_reset(link);
+}
+
+void ax25_link_connect(AX25_Link *link)
+{
+    ax25_link_reset(link);
+
+    link->state = AX25_LINK_AWAITING_CONNECTION;
+    link->t1 = link->t1_init;
+
+    ax25_link_send(link, AX25_CTRL_UNNUMBERED_SABM | AX25_CTRL_PF_TRUE, 1, 0, 0);
+}
+
+void ax25_link_disconnect(AX25_Link *link)
+{
+    if (link->state == AX25_LINK_DISCONNECTED)
+    {
+        return;
+    }
+
+    link->state = AX25_LINK_AWAITING_RELEASE;
+    link->retries = 0;
+    link->t1 = link->t1_init;
+
+    ax25_link_send(link, AX25_CTRL_UNNUMBERED_DISC | AX25_CTRL_PF_TRUE, 1, 0, 0);
+}
+
+uint8_t ax25_link_write(AX25_Link *link, const uint8_t *data, uint16_t len)
+{
+    uint8_t slot = link->tail & AX25_LINK_SEQ_MASK;
+    uint16_t i = 0;
+
+    // A free slot that is not the one of V(A)
+    if ((link->state != AX25_LINK_CONNECTED) || (len > AX25_LINK_N1) || ((uint8_t)(link->tail - link->va) >= AX25_LINK_MODULUS - 1))
+    {
+        return 0;
+    }
+
+    for(i=0; i<len; i++)
+    {
+        link->tx_data[slot][i] = data[i];
+    }
+
+    link->tx_len[slot] = len;
+    link->tail++;
+
+    ax25_link_push(link);
+
+    return 1;
+}
+
+uint8_t ax25_link_idle(AX25_Link *link)
+{
+    return link->va == link->tail;
+}
+
+void ax25_link_receive(AX25_Link *link, const AX25_Packet *ax25_packet)
+{
+    uint8_t ctrl = ax25_packet->control_bits;
+    uint8_t command = (ax25_packet->dst_adr.ssid & AX25_ADR_DST_COMMAND) && !(ax25_packet->src_adr.ssid & AX25_ADR_SRC_RESPONSE);
+
+    if (!ax25_link_same_address(&ax25_packet->dst_adr, &link->local) || !ax25_link_same_address(&ax25_packet->src_adr, &link->remote))
+    {
+        return;
+    }
+
+    if ((ctrl & 0x03) == AX25_CTRL_UNNUMBERED)
+    {
+        ax25_link_receive_u(link, ax25_packet, command);
+    }
+    else if (link->state != AX25_LINK_CONNECTED)
+    {
+        // I and S frames out of a connection
+        if (command && (link->state == AX25_LINK_DISCONNECTED))
+        {
+            ax25_link_send(link, AX25_CTRL_UNNUMBERED_DM | (ctrl & AX25_CTRL_PF_TRUE), 0, 0, 0);
+        }
+    }
+    else if ((ctrl & 0x01) == AX25_CTRL_INFORMATION)
+    {
+        ax25_link_receive_i(link, ax25_packet);
+        ax25_link_push(link);
+    }
+    else
+    {
+        ax25_link_receive_s(link, ax25_packet, command);
+    }
+}
+
+void ax25_link_tick(AX25_Link *link)
+{
+    if ((link->state == AX25_LINK_CONNECTED) && link->ack_pending)
+    {
+        ax25_link_send_s(link, AX25_CTRL_SUPERVISORY_RR, link->vr, AX25_CTRL_PF_FALSE);
+    }
+
+    if ((link->t1 == 0) || (--link->t1 > 0))
+    {
+        return;
+    }
+
+    // T1 expired: retry, or give up the connection
+    if (++link->retries > AX25_LINK_N2)
+    {
+        link->state = AX25_LINK_DISCONNECTED;
+
+        return;
+    }
+
+    link->t1 = link->t1_init;
+
+    switch(link->state)
+    {
+        case AX25_LINK_AWAITING_CONNECTION:
+            ax25_link_send(link, AX25_CTRL_UNNUMBERED_SABM | AX25_CTRL_PF_TRUE, 1, 0, 0);
+            break;
+        case AX25_LINK_AWAITING_RELEASE:
+            ax25_link_send(link, AX25_CTRL_UNNUMBERED_DISC | AX25_CTRL_PF_TRUE, 1, 0, 0);
+            break;
+        case AX25_LINK_CONNECTED:
+            if (link->va != link->vs)
+            {
+                ax25_link_send_i(link, link->va, AX25_CTRL_PF_TRUE);
+
+                link->retransmissions++;
+            }
+            else
+            {
+                link->t1 = 0;
+            }
+
+            break;
+        default:
+            link->t1 = 0;
+            break;
+    }
+}
+
+//! \} End of ax25_link implementation group
@@ -0,0 +1,215 @@
+/*
+ * ax25_link.h
+ * 
+ * Copyright (C) 2017, Federal University of Santa Catarina.
+ * 
+ * This file is part of FloripaSat-Beacon.
+ * 
+ * FloripaSat-Beacon is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-Beacon is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-Beacon. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+ 
+/**
+ * \brief AX25 connected mode (data link layer with I and S frames).
+ * 
+ * A minimal subset of the AX.25 2.2 data link state machine, for reliable bulk transfers:
+ *      - SABM/UA connection and DISC/UA disconnection (DM when not connected).
+ *      - Modulo-8 I frames with a configurable window, acknowledged by RR, RNR, REJ or the N(R) of the I frames.
+ *      - Selective reject: each frame missing before an out of sequence one is requested by a SREJ, and only it is
+ *        retransmitted. The received out of sequence frames are kept until the missing ones arrive.
+ *      - T1 timer recovery: the oldest unacknowledged frame is retransmitted with the poll bit, up to N2 times.
+ *      .
+ * 
+ * A SREJ only requests its N(R) (it does not acknowledge the previous frames), and the selective reject limits
+ * the window to half the sequence space (AX25_LINK_WINDOW_MAX), so a retransmission can not be taken as a new frame.
+ * XID, FRMR, SABME (modulo 128) and segmentation in I frames are not supported.
+ * 
+ * The module does no I/O: the frames to transmit go to a callback (to be encoded with ax25_encoder_init), the
+ * received ones come from ax25_decode, and the timers run on ax25_link_tick calls.
+ * 
+ * \see AX.25 Link Access Protocol for Amateur Packet Radio. Version 2.2 Revision: July 1998. Sections 4.3 and 6.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup ax25_link Connected Mode
+ * \ingroup ax25
+ * \{
+ */
+
+#ifndef AX25_LINK_H_
+#define AX25_LINK_H_
+
+#include <stdint.h>
+
+#include "ax25.h"
+
+/**
+ * \brief Modulus of the sequence numbers.
+ */
+#define AX25_LINK_MODULUS               8
+
+/**
+ * \brief Maximum window size with selective reject (half the sequence space).
+ */
+#define AX25_LINK_WINDOW_MAX            (AX25_LINK_MODULUS/2)
+
+/**
+ * \brief Data link states.
+ */
+typedef enum
+{
+    AX25_LINK_DISCONNECTED = 0,         /**< No connection. */
+    AX25_LINK_AWAITING_CONNECTION,      /**< SABM sent, waiting the UA. */
+    AX25_LINK_CONNECTED,                /**< Information transfer. */
+    AX25_LINK_AWAITING_RELEASE          /**< DISC sent, waiting the UA. */
+} AX25_Link_State;
+
+/**
+ * \brief Transmits a frame (encoding it with ax25_encoder_init or ax25_encode).
+ * 
+ * \param ctx is the context given to ax25_link_init.
+ * \param ax25_packet is the frame, with the FCS already computed.
+ * 
+ * \return None.
+ */
+typedef void (*ax25_link_tx)(void *ctx, const AX25_Packet *ax25_packet);
+
+/**
+ * \brief Delivers the information field of a received I frame, in sequence, to the upper layer.
+ * 
+ * \param ctx is the context given to ax25_link_init.
+ * \param data is the information field.
+ * \param len is the length of data.
+ * 
+ * \return None.
+ */
+typedef void (*ax25_link_rx)(void *ctx, const uint8_t *data, uint16_t len);
+
+/**
+ * \brief Data link state of a connection with a remote station.
+ */
+typedef struct
+{
+    AX25_Link_State state;                                  /**< Current state. */
+    AX25_Transfer_Frame_Header local;                       /**< Address of this station (SSID byte without the C bit). */
+    AX25_Transfer_Frame_Header remote;                      /**< Address of the remote station (SSID byte without the C bit). */
+    uint8_t window;                                         /**< Maximum number of unacknowledged I frames (k). */
+    uint8_t va;                                             /**< Oldest unacknowledged I frame, V(A) (not reduced modulo 8). */
+    uint8_t vs;                                             /**< Next I frame to send, V(S) (not reduced modulo 8). */
+    uint8_t tail;                                           /**< Next free slot of the transmission queue (not reduced modulo 8). */
+    uint8_t vr;                                             /**< Next expected I frame, V(R). */
+    uint8_t rx_valid;                                       /**< Received out of sequence I frames (bit N(S)). */
+    uint8_t srej_sent;                                      /**< Frames requested by a SREJ and not received yet (bit N(S)). */
+    uint8_t ack_pending;                                    /**< Received I frames not acknowledged yet. */
+    uint8_t remote_busy;                                    /**< The remote station sent a RNR. */
+    uint8_t retries;                                        /**< Number of T1 expirations in a row. */
+    uint16_t t1;                                            /**< Remaining T1 periods (0 = stopped). */
+    uint16_t t1_init;                                       /**< T1 value (AX25_LINK_T1 by default). */
+    uint16_t tx_len[AX25_LINK_MODULUS];                     /**< Length of the queued I frames (by sequence number). */
+    uint8_t tx_data[AX25_LINK_MODULUS][AX25_LINK_N1];       /**< Queued and unacknowledged I frames (by sequence number). */
+    uint16_t rx_len[AX25_LINK_MODULUS];                     /**< Length of the out of sequence I frames (by sequence number). */
+    uint8_t rx_data[AX25_LINK_MODULUS][AX25_LINK_N1];       /**< Out of sequence I frames (by sequence number). */
+    uint16_t retransmissions;                               /**< Number of retransmitted I frames. */
+    ax25_link_tx tx;                                        /**< Frame transmission callback. */
+    ax25_link_rx rx;                                        /**< Received data callback. */
+    void *ctx;                                              /**< Context of the callbacks. */
+    AX25_Packet frame;                                      /**< Frame being transmitted. */
+} AX25_Link;
+
+/**
+ * \brief Initializes a data link (disconnected).
+ * 
+ * \param link is the data link state.
+ * \param local_callsign is the callsign of this station.
+ * \param local_ssid is the SSID of this station (0 to 15).
+ * \param remote_callsign is the callsign of the remote station.
+ * \param remote_ssid is the SSID of the remote station (0 to 15).
+ * \param window is the window size (1 to AX25_LINK_WINDOW_MAX).
+ * \param tx is the frame transmission callback.
+ * \param rx is the received data callback.
+ * \param ctx is the context of the callbacks.
+ * 
+ * \return None.
+ */
+void ax25_link_init(AX25_Link *link, const char *local_callsign, uint8_t local_ssid, const char *remote_callsign, uint8_t remote_ssid,
+                    uint8_t window, ax25_link_tx tx, ax25_link_rx rx, void *ctx);
+
+/**
+ * \brief Starts a connection with the remote station (SABM).
+ * 
+ * \param link is the data link state.
+ * 
+ * \return None.
+ */
+void ax25_link_connect(AX25_Link *link);
+
+/**
+ * \brief Ends the connection with the remote station (DISC).
+ * 
+ * \param link is the data link state.
+ * 
+ * \return None.
+ */
+void ax25_link_disconnect(AX25_Link *link);
+
+/**
+ * \brief Queues data to send in an I frame.
+ * 
+ * \param link is the data link state.
+ * \param data is the data.
+ * \param len is the length of data (up to AX25_LINK_N1 bytes).
+ * 
+ * \return 1 if the data was queued, 0 if the link is not connected, the queue is full or the data is too long.
+ */
+uint8_t ax25_link_write(AX25_Link *link, const uint8_t *data, uint16_t len);
+
+/**
+ * \brief Checks if all the queued data was sent and acknowledged.
+ * 
+ * \param link is the data link state.
+ * 
+ * \return 1 if there is no data waiting for an acknowledgement, 0 otherwise.
+ */
+uint8_t ax25_link_idle(AX25_Link *link);
+
+/**
+ * \brief Processes a received frame (decoded by ax25_decode).
+ * 
+ * Frames from other stations or to other stations are ignored.
+ * 
+ * \param link is the data link state.
+ * \param ax25_packet is the received frame.
+ * 
+ * \return None.
+ */
+void ax25_link_receive(AX25_Link *link, const AX25_Packet *ax25_packet);
+
+/**
+ * \brief Runs the data link timers (T1 recovery and the delayed acknowledgement).
+ * 
+ * Must be called periodically (the period is the unit of AX25_LINK_T1).
+ * 
+ * \param link is the data link state.
+ * 
+ * \return None.
+ */
+void ax25_link_tick(AX25_Link *link);
+
+#endif // AX25_LINK_H_
+
+//! \} End of ax25_link group
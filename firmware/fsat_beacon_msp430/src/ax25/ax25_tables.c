@@ -0,0 +1,208 @@
+/*
+ * ax25_tables.c
+ * 
+ * Copyright (C) 2016-2019, Universidade Federal de Santa Catarina.
+ * 
+ * This file is part of FloripaSat-TTC.
+ * 
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief AX25 lookup tables.
+ * 
+ * Generated by host/tools/ax25_tables_gen.c (make -C host ax25_tables). Do not edit.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 1.0-dev
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup ax25
+ * \{
+ */
+
+#include "ax25.h"
+
+const uint16_t ax25_stuffing_table[AX25_STUFF_MAX_ONES][256] = {
+    {
+        0x0000, 0x0080, 0x0040, 0x00C0, 0x0020, 0x00A0, 0x0060, 0x00E0, 0x0010, 0x0090,
+        0x0050, 0x00D0, 0x0030, 0x00B0, 0x0070, 0x00F0, 0x0008, 0x0088, 0x0048, 0x00C8,
+        0x0028, 0x00A8, 0x0068, 0x00E8, 0x0018, 0x0098, 0x0058, 0x00D8, 0x0038, 0x00B8,
+        0x0078, 0x05F0, 0x0004, 0x0084, 0x0044, 0x00C4, 0x0024, 0x00A4, 0x0064, 0x00E4,
+        0x0014, 0x0094, 0x0054, 0x00D4, 0x0034, 0x00B4, 0x0074, 0x00F4, 0x000C, 0x008C,
+        0x004C, 0x00CC, 0x002C, 0x00AC, 0x006C, 0x00EC, 0x001C, 0x009C, 0x005C, 0x00DC,
+        0x003C, 0x00BC, 0x04F8, 0x05F4, 0x0002, 0x0082, 0x0042, 0x00C2, 0x0022, 0x00A2,
+        0x0062, 0x00E2, 0x0012, 0x0092, 0x0052, 0x00D2, 0x0032, 0x00B2, 0x0072, 0x00F2,
+        0x000A, 0x008A, 0x004A, 0x00CA, 0x002A, 0x00AA, 0x006A, 0x00EA, 0x001A, 0x009A,
+        0x005A, 0x00DA, 0x003A, 0x00BA, 0x007A, 0x05F2, 0x0006, 0x0086, 0x0046, 0x00C6,
+        0x0026, 0x00A6, 0x0066, 0x00E6, 0x0016, 0x0096, 0x0056, 0x00D6, 0x0036, 0x00B6,
+        0x0076, 0x00F6, 0x000E, 0x008E, 0x004E, 0x00CE, 0x002E, 0x00AE, 0x006E, 0x00EE,
+        0x001E, 0x009E, 0x005E, 0x00DE, 0x047C, 0x057C, 0x04FA, 0x05F6, 0x1001, 0x1081,
+        0x1041, 0x10C1, 0x1021, 0x10A1, 0x1061, 0x10E1, 0x1011, 0x1091, 0x1051, 0x10D1,
+        0x1031, 0x10B1, 0x1071, 0x10F1, 0x1009, 0x1089, 0x1049, 0x10C9, 0x1029, 0x10A9,
+        0x1069, 0x10E9, 0x1019, 0x1099, 0x1059, 0x10D9, 0x1039, 0x10B9, 0x1079, 0x15F1,
+        0x1005, 0x1085, 0x1045, 0x10C5, 0x1025, 0x10A5, 0x1065, 0x10E5, 0x1015, 0x1095,
+        0x1055, 0x10D5, 0x1035, 0x10B5, 0x1075, 0x10F5, 0x100D, 0x108D, 0x104D, 0x10CD,
+        0x102D, 0x10AD, 0x106D, 0x10ED, 0x101D, 0x109D, 0x105D, 0x10DD, 0x103D, 0x10BD,
+        0x14F9, 0x15F5, 0x2003, 0x2083, 0x2043, 0x20C3, 0x2023, 0x20A3, 0x2063, 0x20E3,
+        0x2013, 0x2093, 0x2053, 0x20D3, 0x2033, 0x20B3, 0x2073, 0x20F3, 0x200B, 0x208B,
+        0x204B, 0x20CB, 0x202B, 0x20AB, 0x206B, 0x20EB, 0x201B, 0x209B, 0x205B, 0x20DB,
+        0x203B, 0x20BB, 0x207B, 0x25F3, 0x3007, 0x3087, 0x3047, 0x30C7, 0x3027, 0x30A7,
+        0x3067, 0x30E7, 0x3017, 0x3097, 0x3057, 0x30D7, 0x3037, 0x30B7, 0x3077, 0x30F7,
+        0x400F, 0x408F, 0x404F, 0x40CF, 0x402F, 0x40AF, 0x406F, 0x40EF, 0x043E, 0x053E,
+        0x04BE, 0x05BE, 0x147D, 0x157D, 0x24FB, 0x35F7
+    },
+    {
+        0x0000, 0x0080, 0x0040, 0x00C0, 0x0020, 0x00A0, 0x0060, 0x00E0, 0x0010, 0x0090,
+        0x0050, 0x00D0, 0x0030, 0x00B0, 0x0070, 0x05E0, 0x0008, 0x0088, 0x0048, 0x00C8,
+        0x0028, 0x00A8, 0x0068, 0x00E8, 0x0018, 0x0098, 0x0058, 0x00D8, 0x0038, 0x00B8,
+        0x0078, 0x05E8, 0x0004, 0x0084, 0x0044, 0x00C4, 0x0024, 0x00A4, 0x0064, 0x00E4,
+        0x0014, 0x0094, 0x0054, 0x00D4, 0x0034, 0x00B4, 0x0074, 0x05E4, 0x000C, 0x008C,
+        0x004C, 0x00CC, 0x002C, 0x00AC, 0x006C, 0x00EC, 0x001C, 0x009C, 0x005C, 0x00DC,
+        0x003C, 0x00BC, 0x04F8, 0x05EC, 0x0002, 0x0082, 0x0042, 0x00C2, 0x0022, 0x00A2,
+        0x0062, 0x00E2, 0x0012, 0x0092, 0x0052, 0x00D2, 0x0032, 0x00B2, 0x0072, 0x05E2,
+        0x000A, 0x008A, 0x004A, 0x00CA, 0x002A, 0x00AA, 0x006A, 0x00EA, 0x001A, 0x009A,
+        0x005A, 0x00DA, 0x003A, 0x00BA, 0x007A, 0x05EA, 0x0006, 0x0086, 0x0046, 0x00C6,
+        0x0026, 0x00A6, 0x0066, 0x00E6, 0x0016, 0x0096, 0x0056, 0x00D6, 0x0036, 0x00B6,
+        0x0076, 0x05E6, 0x000E, 0x008E, 0x004E, 0x00CE, 0x002E, 0x00AE, 0x006E, 0x00EE,
+        0x001E, 0x009E, 0x005E, 0x00DE, 0x047C, 0x057C, 0x04FA, 0x05EE, 0x1001, 0x1081,
+        0x1041, 0x10C1, 0x1021, 0x10A1, 0x1061, 0x10E1, 0x1011, 0x1091, 0x1051, 0x10D1,
+        0x1031, 0x10B1, 0x1071, 0x15E1, 0x1009, 0x1089, 0x1049, 0x10C9, 0x1029, 0x10A9,
+        0x1069, 0x10E9, 0x1019, 0x1099, 0x1059, 0x10D9, 0x1039, 0x10B9, 0x1079, 0x15E9,
+        0x1005, 0x1085, 0x1045, 0x10C5, 0x1025, 0x10A5, 0x1065, 0x10E5, 0x1015, 0x1095,
+        0x1055, 0x10D5, 0x1035, 0x10B5, 0x1075, 0x15E5, 0x100D, 0x108D, 0x104D, 0x10CD,
+        0x102D, 0x10AD, 0x106D, 0x10ED, 0x101D, 0x109D, 0x105D, 0x10DD, 0x103D, 0x10BD,
+        0x14F9, 0x15ED, 0x2003, 0x2083, 0x2043, 0x20C3, 0x2023, 0x20A3, 0x2063, 0x20E3,
+        0x2013, 0x2093, 0x2053, 0x20D3, 0x2033, 0x20B3, 0x2073, 0x25E3, 0x200B, 0x208B,
+        0x204B, 0x20CB, 0x202B, 0x20AB, 0x206B, 0x20EB, 0x201B, 0x209B, 0x205B, 0x20DB,
+        0x203B, 0x20BB, 0x207B, 0x25EB, 0x3007, 0x3087, 0x3047, 0x30C7, 0x3027, 0x30A7,
+        0x3067, 0x30E7, 0x3017, 0x3097, 0x3057, 0x30D7, 0x3037, 0x30B7, 0x3077, 0x35E7,
+        0x400F, 0x408F, 0x404F, 0x40CF, 0x402F, 0x40AF, 0x406F, 0x40EF, 0x043E, 0x053E,
+        0x04BE, 0x05BE, 0x147D, 0x157D, 0x24FB, 0x45EF
+    },
+    {
+        0x0000, 0x0080, 0x0040, 0x00C0, 0x0020, 0x00A0, 0x0060, 0x05C0, 0x0010, 0x0090,
+        0x0050, 0x00D0, 0x0030, 0x00B0, 0x0070, 0x05D0, 0x0008, 0x0088, 0x0048, 0x00C8,
+        0x0028, 0x00A8, 0x0068, 0x05C8, 0x0018, 0x0098, 0x0058, 0x00D8, 0x0038, 0x00B8,
+        0x0078, 0x05D8, 0x0004, 0x0084, 0x0044, 0x00C4, 0x0024, 0x00A4, 0x0064, 0x05C4,
+        0x0014, 0x0094, 0x0054, 0x00D4, 0x0034, 0x00B4, 0x0074, 0x05D4, 0x000C, 0x008C,
+        0x004C, 0x00CC, 0x002C, 0x00AC, 0x006C, 0x05CC, 0x001C, 0x009C, 0x005C, 0x00DC,
+        0x003C, 0x00BC, 0x04F8, 0x05DC, 0x0002, 0x0082, 0x0042, 0x00C2, 0x0022, 0x00A2,
+        0x0062, 0x05C2, 0x0012, 0x0092, 0x0052, 0x00D2, 0x0032, 0x00B2, 0x0072, 0x05D2,
+        0x000A, 0x008A, 0x004A, 0x00CA, 0x002A, 0x00AA, 0x006A, 0x05CA, 0x001A, 0x009A,
+        0x005A, 0x00DA, 0x003A, 0x00BA, 0x007A, 0x05DA, 0x0006, 0x0086, 0x0046, 0x00C6,
+        0x0026, 0x00A6, 0x0066, 0x05C6, 0x0016, 0x0096, 0x0056, 0x00D6, 0x0036, 0x00B6,
+        0x0076, 0x05D6, 0x000E, 0x008E, 0x004E, 0x00CE, 0x002E, 0x00AE, 0x006E, 0x05CE,
+        0x001E, 0x009E, 0x005E, 0x00DE, 0x047C, 0x057C, 0x04FA, 0x05DE, 0x1001, 0x1081,
+        0x1041, 0x10C1, 0x1021, 0x10A1, 0x1061, 0x15C1, 0x1011, 0x1091, 0x1051, 0x10D1,
+        0x1031, 0x10B1, 0x1071, 0x15D1, 0x1009, 0x1089, 0x1049, 0x10C9, 0x1029, 0x10A9,
+        0x1069, 0x15C9, 0x1019, 0x1099, 0x1059, 0x10D9, 0x1039, 0x10B9, 0x1079, 0x15D9,
+        0x1005, 0x1085, 0x1045, 0x10C5, 0x1025, 0x10A5, 0x1065, 0x15C5, 0x1015, 0x1095,
+        0x1055, 0x10D5, 0x1035, 0x10B5, 0x1075, 0x15D5, 0x100D, 0x108D, 0x104D, 0x10CD,
+        0x102D, 0x10AD, 0x106D, 0x15CD, 0x101D, 0x109D, 0x105D, 0x10DD, 0x103D, 0x10BD,
+        0x14F9, 0x15DD, 0x2003, 0x2083, 0x2043, 0x20C3, 0x2023, 0x20A3, 0x2063, 0x25C3,
+        0x2013, 0x2093, 0x2053, 0x20D3, 0x2033, 0x20B3, 0x2073, 0x25D3, 0x200B, 0x208B,
+        0x204B, 0x20CB, 0x202B, 0x20AB, 0x206B, 0x25CB, 0x201B, 0x209B, 0x205B, 0x20DB,
+        0x203B, 0x20BB, 0x207B, 0x25DB, 0x3007, 0x3087, 0x3047, 0x30C7, 0x3027, 0x30A7,
+        0x3067, 0x35C7, 0x3017, 0x3097, 0x3057, 0x30D7, 0x3037, 0x30B7, 0x3077, 0x35D7,
+        0x400F, 0x408F, 0x404F, 0x40CF, 0x402F, 0x40AF, 0x406F, 0x45CF, 0x043E, 0x053E,
+        0x04BE, 0x05BE, 0x147D, 0x157D, 0x24FB, 0x0BBE
+    },
+    {
+        0x0000, 0x0080, 0x0040, 0x0580, 0x0020, 0x00A0, 0x0060, 0x05A0, 0x0010, 0x0090,
+        0x0050, 0x0590, 0x0030, 0x00B0, 0x0070, 0x05B0, 0x0008, 0x0088, 0x0048, 0x0588,
+        0x0028, 0x00A8, 0x0068, 0x05A8, 0x0018, 0x0098, 0x0058, 0x0598, 0x0038, 0x00B8,
+        0x0078, 0x05B8, 0x0004, 0x0084, 0x0044, 0x0584, 0x0024, 0x00A4, 0x0064, 0x05A4,
+        0x0014, 0x0094, 0x0054, 0x0594, 0x0034, 0x00B4, 0x0074, 0x05B4, 0x000C, 0x008C,
+        0x004C, 0x058C, 0x002C, 0x00AC, 0x006C, 0x05AC, 0x001C, 0x009C, 0x005C, 0x059C,
+        0x003C, 0x00BC, 0x04F8, 0x05BC, 0x0002, 0x0082, 0x0042, 0x0582, 0x0022, 0x00A2,
+        0x0062, 0x05A2, 0x0012, 0x0092, 0x0052, 0x0592, 0x0032, 0x00B2, 0x0072, 0x05B2,
+        0x000A, 0x008A, 0x004A, 0x058A, 0x002A, 0x00AA, 0x006A, 0x05AA, 0x001A, 0x009A,
+        0x005A, 0x059A, 0x003A, 0x00BA, 0x007A, 0x05BA, 0x0006, 0x0086, 0x0046, 0x0586,
+        0x0026, 0x00A6, 0x0066, 0x05A6, 0x0016, 0x0096, 0x0056, 0x0596, 0x0036, 0x00B6,
+        0x0076, 0x05B6, 0x000E, 0x008E, 0x004E, 0x058E, 0x002E, 0x00AE, 0x006E, 0x05AE,
+        0x001E, 0x009E, 0x005E, 0x059E, 0x047C, 0x057C, 0x04FA, 0x0B7C, 0x1001, 0x1081,
+        0x1041, 0x1581, 0x1021, 0x10A1, 0x1061, 0x15A1, 0x1011, 0x1091, 0x1051, 0x1591,
+        0x1031, 0x10B1, 0x1071, 0x15B1, 0x1009, 0x1089, 0x1049, 0x1589, 0x1029, 0x10A9,
+        0x1069, 0x15A9, 0x1019, 0x1099, 0x1059, 0x1599, 0x1039, 0x10B9, 0x1079, 0x15B9,
+        0x1005, 0x1085, 0x1045, 0x1585, 0x1025, 0x10A5, 0x1065, 0x15A5, 0x1015, 0x1095,
+        0x1055, 0x1595, 0x1035, 0x10B5, 0x1075, 0x15B5, 0x100D, 0x108D, 0x104D, 0x158D,
+        0x102D, 0x10AD, 0x106D, 0x15AD, 0x101D, 0x109D, 0x105D, 0x159D, 0x103D, 0x10BD,
+        0x14F9, 0x15BD, 0x2003, 0x2083, 0x2043, 0x2583, 0x2023, 0x20A3, 0x2063, 0x25A3,
+        0x2013, 0x2093, 0x2053, 0x2593, 0x2033, 0x20B3, 0x2073, 0x25B3, 0x200B, 0x208B,
+        0x204B, 0x258B, 0x202B, 0x20AB, 0x206B, 0x25AB, 0x201B, 0x209B, 0x205B, 0x259B,
+        0x203B, 0x20BB, 0x207B, 0x25BB, 0x3007, 0x3087, 0x3047, 0x3587, 0x3027, 0x30A7,
+        0x3067, 0x35A7, 0x3017, 0x3097, 0x3057, 0x3597, 0x3037, 0x30B7, 0x3077, 0x35B7,
+        0x400F, 0x408F, 0x404F, 0x458F, 0x402F, 0x40AF, 0x406F, 0x45AF, 0x043E, 0x053E,
+        0x04BE, 0x0B3E, 0x147D, 0x157D, 0x24FB, 0x1B7D
+    },
+    {
+        0x0000, 0x0500, 0x0040, 0x0540, 0x0020, 0x0520, 0x0060, 0x0560, 0x0010, 0x0510,
+        0x0050, 0x0550, 0x0030, 0x0530, 0x0070, 0x0570, 0x0008, 0x0508, 0x0048, 0x0548,
+        0x0028, 0x0528, 0x0068, 0x0568, 0x0018, 0x0518, 0x0058, 0x0558, 0x0038, 0x0538,
+        0x0078, 0x0578, 0x0004, 0x0504, 0x0044, 0x0544, 0x0024, 0x0524, 0x0064, 0x0564,
+        0x0014, 0x0514, 0x0054, 0x0554, 0x0034, 0x0534, 0x0074, 0x0574, 0x000C, 0x050C,
+        0x004C, 0x054C, 0x002C, 0x052C, 0x006C, 0x056C, 0x001C, 0x051C, 0x005C, 0x055C,
+        0x003C, 0x053C, 0x04F8, 0x0AF8, 0x0002, 0x0502, 0x0042, 0x0542, 0x0022, 0x0522,
+        0x0062, 0x0562, 0x0012, 0x0512, 0x0052, 0x0552, 0x0032, 0x0532, 0x0072, 0x0572,
+        0x000A, 0x050A, 0x004A, 0x054A, 0x002A, 0x052A, 0x006A, 0x056A, 0x001A, 0x051A,
+        0x005A, 0x055A, 0x003A, 0x053A, 0x007A, 0x057A, 0x0006, 0x0506, 0x0046, 0x0546,
+        0x0026, 0x0526, 0x0066, 0x0566, 0x0016, 0x0516, 0x0056, 0x0556, 0x0036, 0x0536,
+        0x0076, 0x0576, 0x000E, 0x050E, 0x004E, 0x054E, 0x002E, 0x052E, 0x006E, 0x056E,
+        0x001E, 0x051E, 0x005E, 0x055E, 0x047C, 0x0A7C, 0x04FA, 0x0AFA, 0x1001, 0x1501,
+        0x1041, 0x1541, 0x1021, 0x1521, 0x1061, 0x1561, 0x1011, 0x1511, 0x1051, 0x1551,
+        0x1031, 0x1531, 0x1071, 0x1571, 0x1009, 0x1509, 0x1049, 0x1549, 0x1029, 0x1529,
+        0x1069, 0x1569, 0x1019, 0x1519, 0x1059, 0x1559, 0x1039, 0x1539, 0x1079, 0x1579,
+        0x1005, 0x1505, 0x1045, 0x1545, 0x1025, 0x1525, 0x1065, 0x1565, 0x1015, 0x1515,
+        0x1055, 0x1555, 0x1035, 0x1535, 0x1075, 0x1575, 0x100D, 0x150D, 0x104D, 0x154D,
+        0x102D, 0x152D, 0x106D, 0x156D, 0x101D, 0x151D, 0x105D, 0x155D, 0x103D, 0x153D,
+        0x14F9, 0x1AF9, 0x2003, 0x2503, 0x2043, 0x2543, 0x2023, 0x2523, 0x2063, 0x2563,
+        0x2013, 0x2513, 0x2053, 0x2553, 0x2033, 0x2533, 0x2073, 0x2573, 0x200B, 0x250B,
+        0x204B, 0x254B, 0x202B, 0x252B, 0x206B, 0x256B, 0x201B, 0x251B, 0x205B, 0x255B,
+        0x203B, 0x253B, 0x207B, 0x257B, 0x3007, 0x3507, 0x3047, 0x3547, 0x3027, 0x3527,
+        0x3067, 0x3567, 0x3017, 0x3517, 0x3057, 0x3557, 0x3037, 0x3537, 0x3077, 0x3577,
+        0x400F, 0x450F, 0x404F, 0x454F, 0x402F, 0x452F, 0x406F, 0x456F, 0x043E, 0x0A3E,
+        0x04BE, 0x0ABE, 0x147D, 0x1A7D, 0x24FB, 0x2AFB
+    }
+};
+
+const uint8_t ax25_nrzi_table[256] = {
+    0xAA, 0xAB, 0xA9, 0xA8, 0xAD, 0xAC, 0xAE, 0xAF, 0xA5, 0xA4, 0xA6, 0xA7,
+    0xA2, 0xA3, 0xA1, 0xA0, 0xB5, 0xB4, 0xB6, 0xB7, 0xB2, 0xB3, 0xB1, 0xB0,
+    0xBA, 0xBB, 0xB9, 0xB8, 0xBD, 0xBC, 0xBE, 0xBF, 0x95, 0x94, 0x96, 0x97,
+    0x92, 0x93, 0x91, 0x90, 0x9A, 0x9B, 0x99, 0x98, 0x9D, 0x9C, 0x9E, 0x9F,
+    0x8A, 0x8B, 0x89, 0x88, 0x8D, 0x8C, 0x8E, 0x8F, 0x85, 0x84, 0x86, 0x87,
+    0x82, 0x83, 0x81, 0x80, 0xD5, 0xD4, 0xD6, 0xD7, 0xD2, 0xD3, 0xD1, 0xD0,
+    0xDA, 0xDB, 0xD9, 0xD8, 0xDD, 0xDC, 0xDE, 0xDF, 0xCA, 0xCB, 0xC9, 0xC8,
+    0xCD, 0xCC, 0xCE, 0xCF, 0xC5, 0xC4, 0xC6, 0xC7, 0xC2, 0xC3, 0xC1, 0xC0,
+    0xEA, 0xEB, 0xE9, 0xE8, 0xED, 0xEC, 0xEE, 0xEF, 0xE5, 0xE4, 0xE6, 0xE7,
+    0xE2, 0xE3, 0xE1, 0xE0, 0xF5, 0xF4, 0xF6, 0xF7, 0xF2, 0xF3, 0xF1, 0xF0,
+    0xFA, 0xFB, 0xF9, 0xF8, 0xFD, 0xFC, 0xFE, 0xFF, 0x55, 0x54, 0x56, 0x57,
+    0x52, 0x53, 0x51, 0x50, 0x5A, 0x5B, 0x59, 0x58, 0x5D, 0x5C, 0x5E, 0x5F,
+    0x4A, 0x4B, 0x49, 0x48, 0x4D, 0x4C, 0x4E, 0x4F, 0x45, 0x44, 0x46, 0x47,
+    0x42, 0x43, 0x41, 0x40, 0x6A, 0x6B, 0x69, 0x68, 0x6D, 0x6C, 0x6E, 0x6F,
+    0x65, 0x64, 0x66, 0x67, 0x62, 0x63, 0x61, 0x60, 0x75, 0x74, 0x76, 0x77,
+    0x72, 0x73, 0x71, 0x70, 0x7A, 0x7B, 0x79, 0x78, 0x7D, 0x7C, 0x7E, 0x7F,
+    0x2A, 0x2B, 0x29, 0x28, 0x2D, 0x2C, 0x2E, 0x2F, 0x25, 0x24, 0x26, 0x27,
+    0x22, 0x23, 0x21, 0x20, 0x35, 0x34, 0x36, 0x37, 0x32, 0x33, 0x31, 0x30,
+    0x3A, 0x3B, 0x39, 0x38, 0x3D, 0x3C, 0x3E, 0x3F, 0x15, 0x14, 0x16, 0x17,
+    0x12, 0x13, 0x11, 0x10, 0x1A, 0x1B, 0x19, 0x18, 0x1D, 0x1C, 0x1E, 0x1F,
+    0x0A, 0x0B, 0x09, 0x08, 0x0D, 0x0C, 0x0E, 0x0F, 0x05, 0x04, 0x06, 0x07,
+    0x02, 0x03, 0x01, 0x00
+};
+
+//! \} End of ax25 implementation group
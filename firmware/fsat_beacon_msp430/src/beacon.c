@@ -47,6 +47,61 @@
 
 Beacon beacon;
 
+#if AX25_G3RUH_ENABLED == 1
+static AX25_G3RUH beacon_ax25_line;     /**< AX.25 scrambler state, kept between packets as the line of a continuous transmitter (zero state, as ax25_g3ruh_init). */
+#endif // AX25_G3RUH_ENABLED
+
+/**
+ * \brief Initializes the link state of a module (no data received yet).
+ * 
+ * \param module is the module.
+ * 
+ * \return None.
+ */
+static void beacon_module_init(FSatModule *module)
+{
+    module->data        = module->frame[0];
+    module->data_len    = 0;
+
+    fsp_decoder_init(&module->fsp_rx, module->frame[1]);
+}
+
+/**
+ * \brief Makes a received data packet the current data of a module.
+ * 
+ * The received frame becomes the current one (no copy), and the previous current frame becomes the receive buffer.
+ * 
+ * \param module is the module.
+ * \param pkt is the view of the received packet (in the receive buffer of the module).
+ * 
+ * \return None.
+ */
+static void beacon_set_module_data(FSatModule *module, const FSPView *pkt)
+{
+    if (pkt->length > FSAT_MODULE_DATA_MAX_LEN)
+    {
+        return;
+    }
+
+    module->data        = &pkt->frame[pkt->offset];
+    module->data_len    = pkt->length;
+
+    fsp_decoder_set_frame(&module->fsp_rx, (pkt->frame == module->frame[0])? module->frame[1] : module->frame[0]);
+}
+
+/**
+ * \brief Returns a byte of the current data of a module.
+ * 
+ * \param module is the module.
+ * \param pos is the position of the byte.
+ * 
+ * \return The byte, or FSAT_MODULE_DATA_DEFAULT_BYTE if the data is shorter.
+ */
+static uint8_t beacon_get_module_data_byte(FSatModule *module, uint8_t pos)
+{
+    return (pos < module->data_len)? module->data[pos] : FSAT_MODULE_DATA_DEFAULT_BYTE;
+}
+
 void beacon_init()
 {
     watchdog_init();
@@ -84,8 +139,13 @@ void beacon_init()
 #endif // BEACON_PA
     
     fsp_init(FSP_ADR_TTC);
+    beacon_module_init(&beacon.obdh);
+    beacon_module_init(&beacon.eps);
     
     ngham_init();
+    ngham_decoder_init(&beacon.ngham_rx);
+
+    ax25_init();
 
 #if BEACON_RESET_PARAMS_ON_BOOT == 1
     beacon_reset_params();
@@ -103,7 +163,7 @@ void beacon_init()
 
 void beacon_deinit()
 {
-    ngham_deinit_arrays();
+    // Nothing to release, the NGHam Reed Solomon control blocks are constants
 }
 
 void beacon_run()
@@ -211,11 +271,11 @@ void beacon_set_energy_level()
 
     if ((beacon.obdh.errors == 0) && (!beacon.obdh.is_dead))
     {
-        beacon.energy_level = beacon.obdh.buffer.data[OBDH_PKT_ENERGY_LEVEL_POS];
+        beacon.energy_level = beacon_get_module_data_byte(&beacon.obdh, OBDH_PKT_ENERGY_LEVEL_POS);
     }
     else if ((beacon.eps.errors == 0) && (!beacon.eps.is_dead))
     {
-        beacon.energy_level = beacon.eps.buffer.data[EPS_PKT_ENERGY_LEVEL_POS];
+        beacon.energy_level = beacon_get_module_data_byte(&beacon.eps, EPS_PKT_ENERGY_LEVEL_POS);
     }
     else
     {
@@ -281,27 +341,53 @@ void beacon_check_devices_status()
     }
 }
 
-void beacon_gen_pkt_payload(uint8_t protocol)
+/**
+ * \brief Appends the header of a downlink packet: the packet ID and the satellite callsign.
+ * 
+ * \param pb is the packet builder.
+ * \param pkt_id is the packet ID.
+ * 
+ * \return None.
+ */
+static void beacon_append_pkt_header(PacketBuilder *pb, uint8_t pkt_id)
 {
-    debug_print_event_from_module(DEBUG_INFO, BEACON_MODULE_NAME, "Generating packet payload from ");
+    packet_builder_append_byte(pb, pkt_id);
 
-    if (!buffer_empty(&beacon.pkt_payload))
+    // Fill with 0s when the callsign length is less than 7 characters
+    packet_builder_append_field(pb, (const uint8_t *)SATELLITE_CALLSIGN, sizeof(SATELLITE_CALLSIGN)-1, 7, '0');
+}
+
+/**
+ * \brief Encodes the payload of a packet builder as a NGHam packet, in place, and transmits it.
+ * 
+ * \param pb is the packet builder, with NGH_FRAME_HEADROOM bytes of headroom.
+ * 
+ * \return None.
+ */
+static void beacon_send_ngham_frame(PacketBuilder *pb)
+{
+    if (!ngham_encode_frame(pb, 0))
     {
-        buffer_clear(&beacon.pkt_payload);
+        debug_print_event_from_module(DEBUG_ERROR, BEACON_MODULE_NAME, "Error encoding a NGHam packet!\n\r");
+
+        return;
     }
 
-    // Packet ID
-    uint8_t dummy[2] = {0};
-    buffer_fill(&beacon.pkt_payload, &dummy, 1);
+    beacon.transmitting = true;
 
-    // Packet source callsign
-    uint16_t i;
-    for(i=0; i<(7-(sizeof(SATELLITE_CALLSIGN)-1)); i++)
-    {
-        buffer_append(&beacon.pkt_payload, "0", 1); // Fill with 0s when the callsign length is less than 7 characters
-    }
+    radio_write(packet_builder_data(pb), packet_builder_len(pb));
 
-    buffer_append(&beacon.pkt_payload, SATELLITE_CALLSIGN, sizeof(SATELLITE_CALLSIGN)-1);
+    beacon.transmitting = false;
+}
+
+void beacon_gen_pkt_payload(PacketBuilder *pb, uint8_t protocol)
+{
+    debug_print_event_from_module(DEBUG_INFO, BEACON_MODULE_NAME, "Generating packet payload from ");
+
+    // Packet ID (set below) and packet source callsign
+    beacon_append_pkt_header(pb, 0);
+
+    uint8_t *pkt_id = packet_builder_data(pb);
 
     // Packet data
     if ((beacon.obdh.errors == 0) && (!beacon.obdh.is_dead))
@@ -309,15 +395,15 @@ void beacon_gen_pkt_payload(uint8_t protocol)
 #if BEACON_PACKET_PAYLOAD_CONTENT & PAYLOAD_OBDH_DATA
         debug_print_msg("OBDH data...\n\r");
 
-        buffer_append(&beacon.pkt_payload, beacon.obdh.buffer.data, beacon.obdh.buffer.size);
+        packet_builder_append(pb, beacon.obdh.data, beacon.obdh.data_len);
 
         if (protocol == PACKET_NGHAM)
         {
-            beacon.pkt_payload.data[0] = BEACON_PACKET_ID_NGHAM_OBDH_DATA;
+            *pkt_id = BEACON_PACKET_ID_NGHAM_OBDH_DATA;
         }
         else
         {
-            beacon.pkt_payload.data[0] = BEACON_PACKET_ID_AX25_OBDH_DATA;
+            *pkt_id = BEACON_PACKET_ID_AX25_OBDH_DATA;
         }
 #endif // PAYLOAD_OBDH_DATA
     }
@@ -326,15 +412,15 @@ void beacon_gen_pkt_payload(uint8_t protocol)
 #if BEACON_PACKET_PAYLOAD_CONTENT & PAYLOAD_EPS_DATA
         debug_print_msg("EPS data...\n\r");
 
-        buffer_append(&beacon.pkt_payload, beacon.eps.buffer.data, beacon.eps.buffer.size);
+        packet_builder_append(pb, beacon.eps.data, beacon.eps.data_len);
 
         if (protocol == PACKET_NGHAM)
         {
-            beacon.pkt_payload.data[0] = BEACON_PACKET_ID_NGHAM_EPS_DATA;
+            *pkt_id = BEACON_PACKET_ID_NGHAM_EPS_DATA;
         }
         else
         {
-            beacon.pkt_payload.data[0] = BEACON_PACKET_ID_AX25_EPS_DATA;
+            *pkt_id = BEACON_PACKET_ID_AX25_EPS_DATA;
         }
 #endif // PAYLOAD_EPS_DATA
     }
@@ -342,262 +428,327 @@ void beacon_gen_pkt_payload(uint8_t protocol)
     {
         debug_print_msg("the satellite ID...\n\r");
 
-        buffer_append(&beacon.pkt_payload, SATELLITE_ID, sizeof(SATELLITE_ID)-1);
+        packet_builder_append(pb, (const uint8_t *)SATELLITE_ID, sizeof(SATELLITE_ID)-1);
 
         if (protocol == PACKET_NGHAM)
         {
-            beacon.pkt_payload.data[0] = BEACON_PACKET_ID_NGHAM_TTC_DATA;
+            *pkt_id = BEACON_PACKET_ID_NGHAM_TTC_DATA;
         }
         else
         {
-            beacon.pkt_payload.data[0] = BEACON_PACKET_ID_AX25_TTC_DATA;
+            *pkt_id = BEACON_PACKET_ID_AX25_TTC_DATA;
         }
     }
 }
 
-void beacon_gen_ngham_pkt(uint8_t *ngham_pkt_str, uint16_t *ngham_pkt_str_len)
+void beacon_send_ngham_pkt()
 {
-    debug_print_event_from_module(DEBUG_INFO, BEACON_MODULE_NAME, "Generating a NGHam packet...\n\r");
+    if (!beacon.hibernation)
+    {
+        if (beacon.can_transmit)
+        {
+            debug_print_event_from_module(DEBUG_INFO, BEACON_MODULE_NAME, "Transmitting a NGHam packet...\n\r");
 
-    beacon_gen_pkt_payload(PACKET_NGHAM);
+            uint8_t ngham_frame[NGH_MAX_FRAME_SIZE];
+            PacketBuilder pb;
 
-    NGHam_TX_Packet ngham_packet;
+            // The payload is written once, and the NGHam framing is added around it in the same buffer
+            packet_builder_init(&pb, ngham_frame, sizeof(ngham_frame), NGH_FRAME_HEADROOM);
 
-    ngham_tx_pkt_gen(&ngham_packet, beacon.pkt_payload.data, beacon.pkt_payload.size);
-    ngham_encode(&ngham_packet, ngham_pkt_str, ngham_pkt_str_len);
+            beacon_gen_pkt_payload(&pb, PACKET_NGHAM);
+
+            beacon_send_ngham_frame(&pb);
+        }
+    }
 }
 
-void beacon_gen_ax25_pkt(uint8_t *ax25_pkt_str, uint16_t *ax25_pkt_str_len)
+/**
+ * \brief Gives the next bytes of an AX.25 packet to the radio (radio_tx_source).
+ * 
+ * \param ctx is the AX25_Encoder of the packet.
+ * \param data is the array to store the bytes.
+ * \param len is the number of bytes to store.
+ * 
+ * \return The number of bytes stored in data.
+ */
+static uint16_t beacon_read_ax25_pkt(void *ctx, uint8_t *data, uint16_t len)
 {
-    debug_print_event_from_module(DEBUG_INFO, BEACON_MODULE_NAME, "Generating a AX.25 packet...\n\r");
-
-    beacon_gen_pkt_payload(PACKET_AX25);
-
-    AX25_Packet ax25_packet;
+    return ax25_encoder_read((AX25_Encoder *)ctx, data, len);
+}
 
-    ax25_beacon_pkt_gen(&ax25_packet, beacon.pkt_payload.data, beacon.pkt_payload.size);
-    ax25_encode(&ax25_packet, ax25_pkt_str, ax25_pkt_str_len);
+/**
+ * \brief Gives the next bytes of the AX.25 frames of a segmented block to the radio (radio_tx_source).
+ * 
+ * \param ctx is the AX25_Segmenter of the block.
+ * \param data is the array to store the bytes.
+ * \param len is the number of bytes to store.
+ * 
+ * \return The number of bytes stored in data.
+ */
+static uint16_t beacon_read_ax25_block(void *ctx, uint8_t *data, uint16_t len)
+{
+    return ax25_segmenter_read((AX25_Segmenter *)ctx, data, len);
 }
 
-void beacon_send_ngham_pkt()
+void beacon_send_ax25_pkt()
 {
     if (!beacon.hibernation)
     {
         if (beacon.can_transmit)
         {
-            debug_print_event_from_module(DEBUG_INFO, BEACON_MODULE_NAME, "Transmitting a NGHam packet...\n\r");
+            debug_print_event_from_module(DEBUG_INFO, BEACON_MODULE_NAME, "Transmitting a AX.25 packet...\n\r");
+
+            uint8_t payload[256];
+            PacketBuilder pb;
+
+            packet_builder_init(&pb, payload, sizeof(payload), 0);
 
-            uint8_t ngham_pkt_str[256];
-            uint16_t ngham_pkt_str_len;
+            beacon_gen_pkt_payload(&pb, PACKET_AX25);
 
-            beacon_gen_ngham_pkt(ngham_pkt_str, &ngham_pkt_str_len);
+            AX25_Encoder ax25_encoder;
+
+            // The packet is encoded from the payload buffer while it is transmitted, in blocks of the radio FIFO refill size
+            uint16_t ax25_pkt_len = ax25_beacon_encoder_init(&ax25_encoder, packet_builder_data(&pb), packet_builder_len(&pb));
+
+        #if AX25_G3RUH_ENABLED == 1
+            ax25_encoder_set_g3ruh(&ax25_encoder, &beacon_ax25_line);
+        #endif // AX25_G3RUH_ENABLED
 
             beacon.transmitting = true;
 
-            radio_write(ngham_pkt_str+8, ngham_pkt_str_len-8);  // 8: Removing preamble and sync word from the NGHam packet
+            radio_write_stream(ax25_pkt_len, beacon_read_ax25_pkt, &ax25_encoder);
 
             beacon.transmitting = false;
         }
     }
 }
 
-void beacon_send_ax25_pkt()
+void beacon_send_ax25_block(const uint8_t *data, uint16_t len)
 {
     if (!beacon.hibernation)
     {
         if (beacon.can_transmit)
         {
-            debug_print_event_from_module(DEBUG_INFO, BEACON_MODULE_NAME, "Transmitting a AX.25 packet...\n\r");
+            debug_print_event_from_module(DEBUG_INFO, BEACON_MODULE_NAME, "Transmitting a segmented AX.25 block...\n\r");
+
+            AX25_Segmenter ax25_segmenter;
 
-            uint8_t ax25_pkt_str[256];
-            uint16_t ax25_pkt_str_len;
+            // All the frames go back to back in a single transmission
+            uint16_t ax25_block_len = ax25_segmenter_init(&ax25_segmenter, data, len, AX25_PID_NO_LAYER_3);
 
-            beacon_gen_ax25_pkt(ax25_pkt_str, &ax25_pkt_str_len);
+            if ((ax25_block_len == 0) || (ax25_block_len > RADIO_TX_MAX_LEN))
+            {
+                debug_print_event_from_module(DEBUG_ERROR, BEACON_MODULE_NAME, "The block is too long for a single transmission!\n\r");
+
+                return;
+            }
+
+        #if AX25_G3RUH_ENABLED == 1
+            ax25_segmenter_set_g3ruh(&ax25_segmenter, &beacon_ax25_line);
+        #endif // AX25_G3RUH_ENABLED
 
             beacon.transmitting = true;
 
-            radio_write(ax25_pkt_str, ax25_pkt_str_len);
+            radio_write_stream(ax25_block_len, beacon_read_ax25_block, &ax25_segmenter);
 
             beacon.transmitting = false;
         }
     }
 }
 
-void beacon_process_obdh_pkt()
+/**
+ * \brief Processes a packet received from the OBDH module.
+ * 
+ * \param obdh_pkt is the view of the received packet.
+ * 
+ * \return None.
+ */
+static void beacon_handle_obdh_pkt(const FSPView *obdh_pkt)
 {
-    FSPPacket obdh_pkt;
-    
-    uint8_t fsp_state;
-    
-    fsp_reset();
-
-    while(obdh_available())
+    // Checking if the packet is really from the OBDH module
+    if (obdh_pkt->src_adr != FSP_ADR_OBDH)
     {
-        fsp_state = fsp_decode(obdh_pop(), &obdh_pkt);
+        beacon.obdh.errors++;
         
-        if (fsp_state == FSP_PKT_READY)
-        {
-            break;
-        }
-        else if (fsp_state == FSP_PKT_INVALID)
-        {
-            beacon.obdh.errors++;
-            
-            return;
-        }
-        else
-        {
-            continue;
-        }
+        return;
     }
     
-    if (fsp_state == FSP_PKT_READY)     // Only process a full received packet
+    switch(obdh_pkt->type)
     {
-        // Checking if the packet is really from the OBDH module
-        if (obdh_pkt.src_adr != FSP_ADR_OBDH)
-        {
-            beacon.obdh.errors++;
+        case FSP_PKT_TYPE_DATA:
+            beacon_set_module_data(&beacon.obdh, obdh_pkt);
+            
+            beacon.obdh.time_last_valid_pkt = time_get_seconds();
+            beacon.obdh.errors = 0;
             
             return;
-        }
-        
-        switch(obdh_pkt.type)
-        {
-            case FSP_PKT_TYPE_DATA:
-                buffer_fill(&beacon.obdh.buffer, obdh_pkt.payload, obdh_pkt.length);
-                
-                beacon.obdh.time_last_valid_pkt = time_get_seconds();
-                beacon.obdh.errors = 0;
-                
-                return;
-            case FSP_PKT_TYPE_DATA_WITH_ACK:
-                buffer_fill(&beacon.obdh.buffer, obdh_pkt.payload, obdh_pkt.length);
-                
-                beacon.obdh.time_last_valid_pkt = time_get_seconds();
-                beacon.obdh.errors = 0;
-                
-                FSPPacket obdh_ack_pkt;
-                
-                fsp_gen_ack_pkt(FSP_ADR_OBDH, &obdh_ack_pkt);
-                
-                uint8_t pkt[FSP_PKT_MAX_LENGTH];
-                uint8_t pkt_len;
-                
-                fsp_encode(&obdh_ack_pkt, pkt, &pkt_len);
-                
-                obdh_send(pkt, pkt_len);
-                
-                return;
-        }
-        
-        if (obdh_pkt.type == FSP_PKT_TYPE_CMD)
-        {
-            switch(obdh_pkt.payload[0])
-            {
-                case FSP_CMD_NOP:                   // Nothing to do.
-                    break;
-                case FSP_CMD_SEND_DATA:             // The Beacon module does not send data to others module.
-                    break;
-                case FSP_CMD_REQUEST_RF_MUTEX:      // This command demands an cmd. with ack.
-                    break;
-                case FSP_CMD_HIBERNATION:
-                    beacon_enter_hibernation(BEACON_HIBERNATION_PERIOD_MINUTES);
-                    break;
-            }
-        }
-        
-        if (obdh_pkt.type == FSP_PKT_TYPE_CMD_WITH_ACK)
-        {
+        case FSP_PKT_TYPE_DATA_WITH_ACK:
+            beacon_set_module_data(&beacon.obdh, obdh_pkt);
+            
+            beacon.obdh.time_last_valid_pkt = time_get_seconds();
+            beacon.obdh.errors = 0;
+            
             FSPPacket obdh_ack_pkt;
             
-            switch(obdh_pkt.payload[0])
-            {
-                case FSP_CMD_NOP:
-                    fsp_gen_ack_pkt(FSP_ADR_OBDH, &obdh_ack_pkt);
-                    break;
-                case FSP_CMD_SEND_DATA:
-                    fsp_gen_nack_pkt(FSP_ADR_OBDH, &obdh_ack_pkt);
-                    break;
-                case FSP_CMD_REQUEST_RF_MUTEX:
-                    if (beacon.transmitting == true)
-                    {
-                        fsp_gen_pkt((uint8_t*)FSP_ACK_RF_MUTEX_BUSY, 1, FSP_ADR_OBDH, FSP_PKT_TYPE_ACK, &obdh_ack_pkt);
-                    }
-                    else
-                    {
-                        fsp_gen_pkt((uint8_t*)FSP_ACK_RF_MUTEX_FREE, 1, FSP_ADR_OBDH, FSP_PKT_TYPE_ACK, &obdh_ack_pkt);
-                    }
-                    break;
-                case FSP_CMD_HIBERNATION:
-                    beacon_enter_hibernation(BEACON_HIBERNATION_PERIOD_MINUTES);
-                    fsp_gen_ack_pkt(FSP_ADR_OBDH, &obdh_ack_pkt);
-                    break;
-            }
+            fsp_gen_ack_pkt(FSP_ADR_OBDH, &obdh_ack_pkt);
             
             uint8_t pkt[FSP_PKT_MAX_LENGTH];
             uint8_t pkt_len;
             
             fsp_encode(&obdh_ack_pkt, pkt, &pkt_len);
             
-            beacon.time_obdh_started_tx = time_get_seconds();
-            beacon.can_transmit = false;
-            
             obdh_send(pkt, pkt_len);
+            
+            return;
+    }
+    
+    if (obdh_pkt->type == FSP_PKT_TYPE_CMD)
+    {
+        switch(obdh_pkt->frame[obdh_pkt->offset])
+        {
+            case FSP_CMD_NOP:                   // Nothing to do.
+                break;
+            case FSP_CMD_SEND_DATA:             // The Beacon module does not send data to others module.
+                break;
+            case FSP_CMD_REQUEST_RF_MUTEX:      // This command demands an cmd. with ack.
+                break;
+            case FSP_CMD_HIBERNATION:
+                beacon_enter_hibernation(BEACON_HIBERNATION_PERIOD_MINUTES);
+                break;
         }
     }
+    
+    if (obdh_pkt->type == FSP_PKT_TYPE_CMD_WITH_ACK)
+    {
+        FSPPacket obdh_ack_pkt;
+        
+        switch(obdh_pkt->frame[obdh_pkt->offset])
+        {
+            case FSP_CMD_NOP:
+                fsp_gen_ack_pkt(FSP_ADR_OBDH, &obdh_ack_pkt);
+                break;
+            case FSP_CMD_SEND_DATA:
+                fsp_gen_nack_pkt(FSP_ADR_OBDH, &obdh_ack_pkt);
+                break;
+            case FSP_CMD_REQUEST_RF_MUTEX:
+                if (beacon.transmitting == true)
+                {
+                    fsp_gen_pkt((uint8_t*)FSP_ACK_RF_MUTEX_BUSY, 1, FSP_ADR_OBDH, FSP_PKT_TYPE_ACK, &obdh_ack_pkt);
+                }
+                else
+                {
+                    fsp_gen_pkt((uint8_t*)FSP_ACK_RF_MUTEX_FREE, 1, FSP_ADR_OBDH, FSP_PKT_TYPE_ACK, &obdh_ack_pkt);
+                }
+                break;
+            case FSP_CMD_HIBERNATION:
+                beacon_enter_hibernation(BEACON_HIBERNATION_PERIOD_MINUTES);
+                fsp_gen_ack_pkt(FSP_ADR_OBDH, &obdh_ack_pkt);
+                break;
+        }
+        
+        uint8_t pkt[FSP_PKT_MAX_LENGTH];
+        uint8_t pkt_len;
+        
+        fsp_encode(&obdh_ack_pkt, pkt, &pkt_len);
+        
+        beacon.time_obdh_started_tx = time_get_seconds();
+        beacon.can_transmit = false;
+        
+        obdh_send(pkt, pkt_len);
+    }
 }
 
-void beacon_process_eps_pkt()
+void beacon_process_obdh_pkt()
 {
-    FSPPacket eps_pkt;
-    
-    uint8_t fsp_state;
-    
-    fsp_reset();
+    uint8_t data[QUEUE_LENGTH];
+    uint8_t len = obdh_available();
+    uint16_t pos = 0;
+
+    obdh_read(data, len);
 
-    while(eps_available())
+    // The decoder keeps a partial packet until the next pass
+    while(pos < len)
     {
-        fsp_state = fsp_decode(eps_pop(), &eps_pkt);
-        
+        uint16_t consumed = 0;
+        uint8_t fsp_state = fsp_decoder_read(&beacon.obdh.fsp_rx, &data[pos], len - pos, &consumed);
+
+        pos += consumed;
+
         if (fsp_state == FSP_PKT_READY)
         {
-            break;
+            FSPView obdh_pkt;
+
+            fsp_decoder_view(&beacon.obdh.fsp_rx, &obdh_pkt);
+
+            beacon_handle_obdh_pkt(&obdh_pkt);
         }
         else if (fsp_state == FSP_PKT_INVALID)
         {
-            beacon.eps.errors++;
-            
-            return;
-        }
-        else
-        {
-            continue;
+            beacon.obdh.errors++;
         }
     }
+}
+
+/**
+ * \brief Processes a packet received from the EPS module.
+ * 
+ * \param eps_pkt is the view of the received packet.
+ * 
+ * \return None.
+ */
+static void beacon_handle_eps_pkt(const FSPView *eps_pkt)
+{
+    // Checking if the packet is really from the EPS module
+    if (eps_pkt->src_adr != FSP_ADR_EPS)
+    {
+        beacon.eps.errors++;
+        
+        return;
+    }
     
-    if (fsp_state == FSP_PKT_READY)     // Only process a full received packet
+    switch(eps_pkt->type)
     {
-        // Checking if the packet is really from the EPS module
-        if (eps_pkt.src_adr != FSP_ADR_EPS)
-        {
+        case FSP_PKT_TYPE_DATA:
+            beacon_set_module_data(&beacon.eps, eps_pkt);
+            
+            beacon.eps.time_last_valid_pkt = time_get_seconds();
+            beacon.eps.errors = 0;
+            
+            return;
+        default:
             beacon.eps.errors++;
             
             return;
+    }
+}
+
+void beacon_process_eps_pkt()
+{
+    uint8_t data[QUEUE_LENGTH];
+    uint8_t len = eps_available();
+    uint16_t pos = 0;
+
+    eps_read(data, len);
+
+    // The decoder keeps a partial packet until the next pass
+    while(pos < len)
+    {
+        uint16_t consumed = 0;
+        uint8_t fsp_state = fsp_decoder_read(&beacon.eps.fsp_rx, &data[pos], len - pos, &consumed);
+
+        pos += consumed;
+
+        if (fsp_state == FSP_PKT_READY)
+        {
+            FSPView eps_pkt;
+
+            fsp_decoder_view(&beacon.eps.fsp_rx, &eps_pkt);
+
+            beacon_handle_eps_pkt(&eps_pkt);
         }
-        
-        switch(eps_pkt.type)
+        else if (fsp_state == FSP_PKT_INVALID)
         {
-            case FSP_PKT_TYPE_DATA:
-                buffer_fill(&beacon.eps.buffer, eps_pkt.payload, eps_pkt.length);
-                
-                beacon.eps.time_last_valid_pkt = time_get_seconds();
-                beacon.eps.errors = 0;
-                
-                return;
-            default:
-                beacon.eps.errors++;
-                
-                return;
+            beacon.eps.errors++;
         }
     }
 }
@@ -606,17 +757,48 @@ void beacon_process_radio_pkt()
 {
     uint8_t pkt[90];
     uint16_t pkt_len = 90;
-    uint8_t pkt_pl[60];
-    uint16_t pkt_pl_len = 0;
+    uint8_t pkt_pl[NGHAM_PL_MAX];
+    uint8_t pkt_pl_len = 0;
+    uint8_t eras_pos[RADIO_MAX_ERASURES];
+    uint8_t no_eras = 0;
+    uint8_t e = 0;
+    uint16_t consumed = 0;
     uint16_t i = 0;
+    uint8_t state = PKT_CONDITION_PREFAIL;
+    uint8_t reply_frame[NGH_MAX_FRAME_SIZE];
+    PacketBuilder reply;
 
     if (radio_available())
     {
-        radio_read(pkt, pkt_len);
+        // A packet in progress can not go on after a dropped read
+        if (!radio_read(pkt, pkt_len))
+        {
+            debug_print_event_from_module(DEBUG_ERROR, BEACON_MODULE_NAME, "Radio read dropped!\n\r");
+
+            ngham_decoder_init(&beacon.ngham_rx);
+
+            return;
+        }
 
-        for(i=0; i<pkt_len; i++)
+        no_eras = radio_get_erasures(eras_pos);
+
+        for(i=0; i<pkt_len; i+=consumed)
         {
-            uint8_t state = ngham_decode(pkt[i], pkt_pl, &pkt_pl_len);
+            uint16_t block_len = pkt_len - i;
+
+            // Bytes the radio could not deliver intact are decoded as erasures, so each block ends before the next one
+            if ((e < no_eras) && (eras_pos[e] == i))
+            {
+                ngham_decoder_mark_erasure(&beacon.ngham_rx);
+                e++;
+            }
+
+            if (e < no_eras)
+            {
+                block_len = eras_pos[e] - i;
+            }
+
+            state = ngham_decode_block(&beacon.ngham_rx, &pkt[i], block_len, &consumed, pkt_pl, &pkt_pl_len);
 
             if (state == PKT_CONDITION_OK)
             {
@@ -645,6 +827,12 @@ void beacon_process_radio_pkt()
         return;
     }
 
+    // The packet may go on in the next read
+    if (state != PKT_CONDITION_OK)
+    {
+        return;
+    }
+
     // Process telecommand
     switch(pkt_pl[0])
     {
@@ -658,37 +846,13 @@ void beacon_process_radio_pkt()
 
             debug_print_msg("!\n\r");
 
-            // Ping answer packet ID
-            pkt_pl[0] = BEACON_PACKET_ID_PING_ANSWER;
+            // Ping answer: packet ID, source (this satellite) and destination (the requester) callsigns
+            packet_builder_init(&reply, reply_frame, sizeof(reply_frame), NGH_FRAME_HEADROOM);
 
-            // Ping answer packet destination
-            for(i=0; i<7; i++)
-            {
-                pkt_pl[i+1+7] = pkt_pl[i+1];
-            }
-
-            // Ping answer packet source
-            uint8_t j = 0;
-            for(i=0; i<(7-(sizeof(SATELLITE_CALLSIGN)-1)); i++)
-            {
-                pkt_pl[i+1] = '0';  // Fill with 0s when the callsign length is less than 7 characters
-                j++;
-            }
+            beacon_append_pkt_header(&reply, BEACON_PACKET_ID_PING_ANSWER);
+            packet_builder_append(&reply, &pkt_pl[1], 7);
 
-            for(i=0; i<sizeof(SATELLITE_CALLSIGN)-1; i++)
-            {
-                pkt_pl[i+1+j] = SATELLITE_CALLSIGN[i];
-            }
-
-            NGHam_TX_Packet ngham_packet;
-
-            ngham_tx_pkt_gen(&ngham_packet, pkt_pl, 1+7+7);
-
-            ngham_encode(&ngham_packet, pkt, pkt_len);
-
-            beacon.transmitting = true;
-            radio_write(pkt+8, pkt_len-8);  // 8: Removing preamble and sync word from the NGHam packet
-            beacon.transmitting = false;
+            beacon_send_ngham_frame(&reply);
 
             break;
         case TELECOMMAND_ID_ENTER_HIBERNATION:
@@ -748,49 +912,18 @@ void beacon_process_radio_pkt()
 
             debug_print_msg("!\n\r");
 
-            uint8_t pkt_broadcast[60];
+            // Message broadcast: packet ID, source (this satellite), origin and destination callsigns and the message
+            packet_builder_init(&reply, reply_frame, sizeof(reply_frame), NGH_FRAME_HEADROOM);
 
-            // Message broadcast packet ID
-            pkt_broadcast[0] = BEACON_PACKET_ID_MESSAGE_BROADCAST;
+            beacon_append_pkt_header(&reply, BEACON_PACKET_ID_MESSAGE_BROADCAST);
+            packet_builder_append(&reply, &pkt_pl[1], 7+7);
 
-            // Message broadcast packet source callsign
-            j = 0;
-            for(i=0; i<(7-(sizeof(SATELLITE_CALLSIGN)-1)); i++)
+            if (pkt_pl_len > 1+7+7)
             {
-                pkt_broadcast[i+1] = '0';   // Fill with 0s when the callsign length is less than 7 characters
-                j++;
+                packet_builder_append(&reply, &pkt_pl[1+7+7], pkt_pl_len-1-7-7);
             }
 
-            for(i=0; i<sizeof(SATELLITE_CALLSIGN)-1; i++)
-            {
-                pkt_broadcast[i+1+j] = SATELLITE_CALLSIGN[i];
-            }
-
-            // Message broadcast packet origin callsign
-            for(i=0; i<7; i++)
-            {
-                pkt_broadcast[i+1+7] = pkt_pl[i+1];
-            }
-
-            // Message broadcast packet destination callsign
-            for(i=0; i<7; i++)
-            {
-                pkt_broadcast[i+1+7+7] = pkt_pl[i+1+7];
-            }
-
-            // Message
-            for(i=0; i<(pkt_pl_len-7-7-1); i++)
-            {
-                pkt_broadcast[i+1+7+7+7] = pkt_pl[i+1+7+7];
-            }
-
-            ngham_tx_pkt_gen(&ngham_packet, pkt_broadcast, 1+7+7+7+(pkt_pl_len-7-7-1));
-
-            ngham_encode(&ngham_packet, pkt, pkt_len);
-
-            beacon.transmitting = true;
-            radio_write(pkt+8, pkt_len-8);  // 8: Removing preamble and sync word from the NGHam packet
-            beacon.transmitting = false;
+            beacon_send_ngham_frame(&reply);
 
             break;
         default:
@@ -798,43 +931,17 @@ void beacon_process_radio_pkt()
             debug_print_hex(pkt_pl[0]);
             debug_print_msg(")\n\r");
 
-            // RR packet ID
-            pkt_pl[0] = 0x0F;
+            // RR packet: packet ID, source (this satellite) and destination (the requester) callsigns and the link
+            packet_builder_init(&reply, reply_frame, sizeof(reply_frame), NGH_FRAME_HEADROOM);
 
-            // RR packet destination
-            for(i=0; i<7; i++)
-            {
-                pkt_pl[i+1+7] = pkt_pl[i+1];
-            }
+            beacon_append_pkt_header(&reply, 0x0F);
+            packet_builder_append(&reply, &pkt_pl[1], 7);
 
-            // RR packet source
-            j = 0;
-            for(i=0; i<(7-(sizeof(SATELLITE_CALLSIGN)-1)); i++)
-            {
-                pkt_pl[i+1] = '0';  // Fill with 0s when the callsign length is less than 7 characters
-                j++;
-            }
-
-            for(i=0; i<sizeof(SATELLITE_CALLSIGN)-1; i++)
-            {
-                pkt_pl[i+1+j] = SATELLITE_CALLSIGN[i];
-            }
-
-            // RR link
             uint8_t rr_link[] = "https://youtu.be/dQw4w9WgXcQ";
 
-            for(i=0; i<sizeof(rr_link)-1; i++)
-            {
-                pkt_pl[i+1+7+7] = rr_link[i];
-            }
-
-            ngham_tx_pkt_gen(&ngham_packet, pkt_pl, 1+7+7+sizeof(rr_link)-1);
-
-            ngham_encode(&ngham_packet, pkt, pkt_len);
+            packet_builder_append(&reply, rr_link, sizeof(rr_link)-1);
 
-            beacon.transmitting = true;
-            radio_write(pkt+8, pkt_len-8);  // 8: Removing preamble and sync word from the NGHam packet
-            beacon.transmitting = false;
+            beacon_send_ngham_frame(&reply);
     }
 }
 
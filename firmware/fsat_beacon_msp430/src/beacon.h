@@ -41,8 +41,10 @@
 #include <stdbool.h>
 
 #include <system/buffer/buffer.h>
+#include <system/packet_builder/packet_builder.h>
 
 #include "fsat_module.h"
+#include "ngham/ngham.h"
 
 /**
  * \brief Beacon variables struct.
@@ -67,9 +69,9 @@ typedef struct
     uint32_t    hibernation_mode_duration;      /**< Hibernation mode duration in seconds. */
     uint32_t    time_obdh_started_tx;           /**< Time stamp of the allowed window to OBDH transmit data via radio. */
     Buffer      radio_rx;                       /**< Radio RX data buffer. */
-    Buffer      pkt_payload;                    /**< The current payload to transmit in a packet (With the OBDH or EPS data, or only with the satellite ID). */
     FSatModule  obdh;                           /**< OBDH module. */
     FSatModule  eps;                            /**< EPS module. */
+    NGHamDecoder ngham_rx;                      /**< NGHam decoder of the radio RX packets. */
 } Beacon;
 
 /**
@@ -128,6 +130,7 @@ uint8_t beacon_get_tx_period();
  * 
  * If the last OBDH data is not valid, the last valid EPS data is used to generate the packet payload.
  * 
+ * \param[in,out] pb is the packet builder to append the payload to (empty).
  * \param[in] protocol is the packet protocol to generate the payload:
  * \parblock
  *      - PACKET_NGHAM
@@ -137,41 +140,33 @@ uint8_t beacon_get_tx_period();
  *
  * \return None.
  */
-void beacon_gen_pkt_payload(uint8_t protocol);
+void beacon_gen_pkt_payload(PacketBuilder *pb, uint8_t protocol);
 
 /**
- * \brief Generates a payload and a NGHam packets to transmit.
- * 
- * \param ngham_pkt_str is a pointer to an array to store the NGHam packet.
- * \param ngham_pkt_str_len is a pointer to a byte to store the lenght of the NGHam packet.
+ * \brief Transmit a beacon packet using the NGHam protocol.
  * 
  * \return None.
  */
-void beacon_gen_ngham_pkt(uint8_t *ngham_pkt_str, uint16_t *ngham_pkt_str_len);
+void beacon_send_ngham_pkt();
 
 /**
- * \brief Generates a payload and an AX.25 packet to transmit.
- * 
- * \param ax25_pkt_str is a pointer to an array to store the AX.25 packet.
- * \param ax25_pkt_str_lens is a pointer to a byte to store the lenght of the AX.25 packet.
+ * \brief Transmit a beacon packet using the AX.25 protocol.
  * 
  * \return None.
  */
-void beacon_gen_ax25_pkt(uint8_t *ax25_pkt_str, uint16_t *ax25_pkt_str_len);
+void beacon_send_ax25_pkt();
 
 /**
- * \brief Transmit a beacon packet using the NGHam protocol.
+ * \brief Transmit a block of data longer than a packet (ex.: a full OBDH data dump) using the AX.25 segmentation.
  * 
- * \return None.
- */
-void beacon_send_ngham_pkt();
-
-/**
- * \brief Transmit a beacon packet using the AX.25 protocol.
+ * The block is sent in sequenced UI frames, back to back, in a single radio transmission.
+ * 
+ * \param data is the block to transmit.
+ * \param len is the length of the block (up to RADIO_TX_MAX_LEN bytes after the encoding, about 6 kB of data).
  * 
  * \return None.
  */
-void beacon_send_ax25_pkt();
+void beacon_send_ax25_block(const uint8_t *data, uint16_t len);
 
 /**
  * \brief Sets the beacon energy level (From the data received from the OBDH or EPS modules).
@@ -199,14 +194,18 @@ void beacon_check_devices_status();
 void beacon_process_radio_pkt();
 
 /**
- * \brief Processes a packet from the OBDH module.
+ * \brief Processes the packets from the OBDH module.
+ * 
+ * Decodes all the bytes in the OBDH queue. A packet split between two passes is completed in the next one.
  * 
  * \return None.
  */
 void beacon_process_obdh_pkt();
 
 /**
- * \brief Processes a packet from the EPS module.
+ * \brief Processes the packets from the EPS module.
+ * 
+ * Decodes all the bytes in the EPS queue. A packet split between two passes is completed in the next one.
  * 
  * \return None.
  */
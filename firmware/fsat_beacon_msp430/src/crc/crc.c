@@ -0,0 +1,210 @@
+/*
+ * crc.c
+ *
+ * Copyright (C) 2017, Federal University of Santa Catarina
+ *
+ * This file is part of FloripaSat-TTC.
+ *
+ * FloripaSat-TTC is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-TTC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-TTC.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief CRC engine implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \addtogroup crc
+ * \{
+ */
+
+#include "crc.h"
+
+const CRC_Model crc16_xmodem    = {16, 0x1021, 0x0000, 0x0000, false, crc16_ccitt_table};
+const CRC_Model crc16_x25       = {16, 0x1021, 0xFFFF, 0xFFFF, true, crc16_ccitt_reflected_table};
+
+/**
+ * \brief Reflects the lower bits of a value.
+ *
+ * \param value is the value to reflect.
+ * \param width is the number of bits to reflect.
+ *
+ * \return The reflected value.
+ */
+static uint16_t crc_reflect(uint16_t value, uint8_t width)
+{
+    uint16_t res = 0;
+    uint8_t i = 0;
+
+    for(i=0; i<width; i++)
+    {
+        res = (res << 1) | ((value >> i) & 0x0001);
+    }
+
+    return res;
+}
+
+/**
+ * \brief Bitwise CRC update (models without lookup tables).
+ *
+ * \param model is the CRC model.
+ * \param crc is the current register.
+ * \param data is the data to feed.
+ * \param len is the length of the data.
+ *
+ * \return The updated register.
+ */
+static uint16_t crc_update_bitwise(const CRC_Model *model, uint16_t crc, const uint8_t *data, uint16_t len)
+{
+    uint16_t poly = 0;
+    uint16_t i = 0;
+    uint8_t j = 0;
+
+    if (model->reflected)
+    {
+        poly = crc_reflect(model->poly, model->width);
+
+        for(i=0; i<len; i++)
+        {
+            crc ^= data[i];
+            for(j=0; j<8; j++)
+            {
+                crc = (crc & 0x0001)? (crc >> 1) ^ poly : crc >> 1;
+            }
+        }
+    }
+    else
+    {
+        poly = model->poly << (16 - model->width);
+
+        for(i=0; i<len; i++)
+        {
+            crc ^= (uint16_t)data[i] << 8;
+            for(j=0; j<8; j++)
+            {
+                crc = (crc & 0x8000)? (crc << 1) ^ poly : crc << 1;
+            }
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * \brief Table driven CRC update of a reflected model.
+ *
+ * \param table is the lookup tables of the model.
+ * \param crc is the current register.
+ * \param data is the data to feed.
+ * \param len is the length of the data.
+ *
+ * \return The updated register.
+ */
+static uint16_t crc_update_reflected(const uint16_t (*table)[256], uint16_t crc, const uint8_t *data, uint16_t len)
+{
+#if CRC_SLICES == 4
+    while(len >= 4)
+    {
+        crc ^= data[0] | ((uint16_t)data[1] << 8);
+        crc = table[3][crc & 0xFF] ^ table[2][crc >> 8] ^ table[1][data[2]] ^ table[0][data[3]];
+
+        data += 4;
+        len -= 4;
+    }
+#endif // CRC_SLICES
+
+    while(len--)
+    {
+        crc = (crc >> 8) ^ table[0][(uint8_t)crc ^ *data++];
+    }
+
+    return crc;
+}
+
+/**
+ * \brief Table driven CRC update of a non reflected model.
+ *
+ * \param table is the lookup tables of the model.
+ * \param crc is the current register.
+ * \param data is the data to feed.
+ * \param len is the length of the data.
+ *
+ * \return The updated register.
+ */
+static uint16_t crc_update_normal(const uint16_t (*table)[256], uint16_t crc, const uint8_t *data, uint16_t len)
+{
+#if CRC_SLICES == 4
+    while(len >= 4)
+    {
+        crc ^= ((uint16_t)data[0] << 8) | data[1];
+        crc = table[3][crc >> 8] ^ table[2][crc & 0xFF] ^ table[1][data[2]] ^ table[0][data[3]];
+
+        data += 4;
+        len -= 4;
+    }
+#endif // CRC_SLICES
+
+    while(len--)
+    {
+        crc = (crc << 8) ^ table[0][(crc >> 8) ^ *data++];
+    }
+
+    return crc;
+}
+
+uint16_t crc_init(const CRC_Model *model)
+{
+    if (model->reflected)
+    {
+        return crc_reflect(model->init, model->width);
+    }
+
+    return model->init << (16 - model->width);
+}
+
+uint16_t crc_update(const CRC_Model *model, uint16_t crc, const uint8_t *data, uint16_t len)
+{
+    if (model->table == NULL)
+    {
+        return crc_update_bitwise(model, crc, data, len);
+    }
+
+    if (model->reflected)
+    {
+        return crc_update_reflected(model->table, crc, data, len);
+    }
+
+    return crc_update_normal(model->table, crc, data, len);
+}
+
+uint16_t crc_final(const CRC_Model *model, uint16_t crc)
+{
+    if (!model->reflected)
+    {
+        crc >>= 16 - model->width;
+    }
+
+    return crc ^ model->xorout;
+}
+
+uint16_t crc_compute(const CRC_Model *model, const uint8_t *data, uint16_t len)
+{
+    return crc_final(model, crc_update(model, crc_init(model), data, len));
+}
+
+//! \} End of crc group
@@ -23,6 +23,12 @@
 /**
  * \brief CRC functions.
  * 
+ * Every CRC of the packet paths (FSP, AX.25 FCS and NGHam) is computed by the same table driven engine, described by
+ * a CRC_Model (Rocksoft parameters). The register of a CRC in progress is kept in the orientation of the tables:
+ *      - Non reflected models: left aligned in 16 bits (equal to the CRC value for the 16 bits models).
+ *      - Reflected models: right aligned (equal to the CRC value before the final XOR).
+ *      .
+ * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
  * \version 1.0-dev
@@ -38,10 +44,123 @@
 #define CRC_H_
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * \brief Number of lookup tables of each model (slice-by-N).
+ * 
+ * The host build processes 4 bytes per iteration with 4 tables (2 kB per model); the MSP430 build uses a single
+ * table (512 bytes per model in flash).
+ */
+#ifndef CRC_SLICES
+#if defined(__GNUC__) && !defined(__MSP430__)
+#define CRC_SLICES                      4
+#else
+#define CRC_SLICES                      1
+#endif // __GNUC__
+#endif // CRC_SLICES
+
+/**
+ * \brief CRC model (Rocksoft parameters).
+ * 
+ * The input and the output reflections are equal (true for every model in use).
+ */
+typedef struct
+{
+    uint8_t width;                      /**< Width in bits (8 to 16). */
+    uint16_t poly;                      /**< Polynomial, normal representation, without the x^width term. */
+    uint16_t init;                      /**< Initial value (normal representation). */
+    uint16_t xorout;                    /**< Value XORed with the final register. */
+    bool reflected;                     /**< Input and output reflected (LSB first). */
+    const uint16_t (*table)[256];       /**< CRC_SLICES lookup tables (generated), or NULL for the bitwise computation. */
+} CRC_Model;
+
+/**
+ * \brief CRC-16/XMODEM (x^16 + x^12 + x^5 + 1, MSB first, init 0x0000). Used by FSP.
+ */
+extern const CRC_Model crc16_xmodem;
+
+/**
+ * \brief CRC-16/X-25 (x^16 + x^12 + x^5 + 1, LSB first, init and xorout 0xFFFF). Used by the AX.25 FCS and NGHam.
+ */
+extern const CRC_Model crc16_x25;
+
+/**
+ * \brief Lookup tables of x^16 + x^12 + x^5 + 1, non reflected.
+ * 
+ * Generated by host/tools/crc_tables_gen.c (src/crc/crc_tables.c).
+ */
+extern const uint16_t crc16_ccitt_table[CRC_SLICES][256];
+
+/**
+ * \brief Lookup tables of x^16 + x^12 + x^5 + 1, reflected.
+ * 
+ * Generated by host/tools/crc_tables_gen.c (src/crc/crc_tables.c).
+ */
+extern const uint16_t crc16_ccitt_reflected_table[CRC_SLICES][256];
+
+/**
+ * \brief CRC8-CCITT polynomial (x^8 + x^2 + x + 1).
+ */
+#define CRC8_CCITT_POLYNOMIAL           0x07
+
+/**
+ * \brief Lookup table of the CRC8-CCITT polynomial (MSB first).
+ * 
+ * Generated by host/tools/crc_tables_gen.c (src/crc/crc_tables.c).
+ */
+extern const uint8_t crc8_ccitt_table[256];
+
+/**
+ * \brief Starts a CRC computation.
+ * 
+ * \param model is the CRC model.
+ * 
+ * \return The initial register.
+ */
+uint16_t crc_init(const CRC_Model *model);
+
+/**
+ * \brief Feeds data to a CRC computation.
+ * 
+ * The data can be split in any number of calls.
+ * 
+ * \param model is the CRC model.
+ * \param crc is the current register (from crc_init or a previous crc_update).
+ * \param data is the data to feed.
+ * \param len is the length of the data.
+ * 
+ * \return The updated register.
+ */
+uint16_t crc_update(const CRC_Model *model, uint16_t crc, const uint8_t *data, uint16_t len);
+
+/**
+ * \brief Ends a CRC computation.
+ * 
+ * \param model is the CRC model.
+ * \param crc is the register after the last crc_update.
+ * 
+ * \return The CRC value.
+ */
+uint16_t crc_final(const CRC_Model *model, uint16_t crc);
+
+/**
+ * \brief Computes the CRC value of an array of data (crc_init, crc_update and crc_final).
+ * 
+ * \param model is the CRC model.
+ * \param data is the data to compute the CRC value.
+ * \param len is the length of the data.
+ * 
+ * \return The CRC value of the data.
+ */
+uint16_t crc_compute(const CRC_Model *model, const uint8_t *data, uint16_t len);
 
 /**
  * \brief CRC8 checksum.
  * 
+ * The CRC8-CCITT polynomial uses the lookup table (one step per byte), the others are computed bit by bit.
+ * 
  * \param initial_value is the initial value of the crc8.
  * \param polynomial is the crc8 polynomial.
  * \param data is data to calculate the crc8.
@@ -52,19 +171,19 @@
 uint8_t crc8(uint8_t initial_value, uint8_t polynomial, uint8_t *data, uint8_t len);
 
 /**
- * \brief Computes the CRC16 value of an array of data.
+ * \brief Computes the CRC16 value of an array of data (MSB first, bitwise).
  * 
  * \param initial_value is the initial value of the CRC16.
  * \param polynomial is the CRC16 polynomial.
- * \param data is data to calculate the crc8.
- * \param len is lenght of the data.
+ * \param data is data to calculate the CRC16.
+ * \param size is lenght of the data.
  * 
- * \return The crc8 value of the given data.
+ * \return The CRC16 value of the given data.
  */
 uint16_t crc16(uint16_t initial_value, uint8_t polynomial, uint8_t* data, uint8_t size);
 
 /**
- * \brief Computes the CRC16-CCITT value of an array of data.
+ * \brief Computes the CRC16-CCITT value of an array of data (CRC-16/XMODEM register, see crc16_xmodem).
  * 
  * \param initial_value is the initial value to compute the crc16 value.
  * \param data is the data to compute the crc16 value.
@@ -72,7 +191,7 @@ uint16_t crc16(uint16_t initial_value, uint8_t polynomial, uint8_t* data, uint8_
  * 
  * \return Returns the crc16 value of the data.
  */
-uint16_t crc16_CCITT(uint16_t initial_value, uint8_t* data, uint8_t size);
+uint16_t crc16_CCITT(uint16_t initial_value, uint8_t* data, uint16_t size);
 
 #endif // CRC_H_
 
@@ -37,22 +37,14 @@
 
 uint16_t crc16(uint16_t initial_value, uint8_t polynomial, uint8_t* data, uint8_t size)
 {
-   return 0x00; 
+    const CRC_Model model = {16, polynomial, initial_value, 0x0000, false, NULL};
+
+    return crc_update(&model, initial_value, data, size);
 }
 
-uint16_t crc16_CCITT(uint16_t initial_value, uint8_t* data, uint8_t size)
+uint16_t crc16_CCITT(uint16_t initial_value, uint8_t* data, uint16_t size)
 {
-    uint8_t x;
-    uint16_t crc = initial_value;
-
-    while(size--)
-    {
-        x = crc >> 8 ^ *data++;
-        x ^= x >> 4;
-        crc = (crc << 8) ^ ((uint16_t)(x << 12)) ^ ((uint16_t)(x << 5)) ^ ((uint16_t)x);
-    }
-    
-    return crc;
+    return crc_update(&crc16_xmodem, initial_value, data, size);
 }
 
 //! \} End of crc group
@@ -38,6 +38,17 @@
 uint8_t crc8(uint8_t initial_value, uint8_t polynomial, uint8_t *data, uint8_t len)
 {
     uint8_t crc = initial_value;
+
+    if (polynomial == CRC8_CCITT_POLYNOMIAL)
+    {
+        while(len--)
+        {
+            crc = crc8_ccitt_table[crc ^ *data++];
+        }
+
+        return crc;
+    }
+
     while(len--)
     {
         crc ^= *data++;
@@ -40,7 +40,10 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-#include <system/buffer/buffer.h>
+#include "fsp/fsp.h"
+
+#define FSAT_MODULE_DATA_MAX_LEN        128     /**< Longest data kept from a module (longer packets are ignored). */
+#define FSAT_MODULE_DATA_DEFAULT_BYTE   0xFF    /**< Value of the data bytes not received. */
 
 /**
  * \brief A struct to implement a generic module from the FloripaSat satellite.
@@ -52,7 +55,10 @@ typedef struct
     uint32_t    time_last_valid_pkt;    /**< Time stamp of the last valid received packet. */
     uint8_t     errors;                 /**< Number of errors (Packets with errors). */
     bool        is_dead;                /**< If true, the module is not sending data, so it is possibly not working. */
-    Buffer      buffer;                 /**< Last received data from the module. */
+    uint8_t     *data;                  /**< Last received data from the module (payload of the current frame, in place). */
+    uint8_t     data_len;               /**< Length of the last received data (0 if none). */
+    uint8_t     frame[2][FSP_FRAME_MAX_LENGTH]; /**< The current frame and the receive buffer of fsp_rx (swapped at each valid data packet). */
+    FSPDecoder  fsp_rx;                 /**< Decoder of the FSP link with the module (kept between the main loop passes). */
 } FSatModule;
 
 #endif // FSAT_MODULE_H_
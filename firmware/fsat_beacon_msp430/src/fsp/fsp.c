@@ -39,18 +39,22 @@
 
 uint8_t fsp_my_adr;
 
-uint8_t fsp_decode_pos = 0;
-
-void fsp_init(uint8_t module_adr)
+/**
+ * \brief Feeds one byte to a FSP CRC16 (CRC-16/XMODEM, table driven).
+ * 
+ * \param crc is the current CRC16 value.
+ * \param byte is the byte.
+ * 
+ * \return The updated CRC16 value.
+ */
+static uint16_t fsp_crc16_update(uint16_t crc, uint8_t byte)
 {
-    fsp_my_adr = module_adr;
-    
-    fsp_decode_pos = 0;
+    return (crc << 8) ^ crc16_ccitt_table[0][(crc >> 8) ^ byte];
 }
 
-void fsp_reset()
+void fsp_init(uint8_t module_adr)
 {
-    fsp_decode_pos = 0;
+    fsp_my_adr = module_adr;
 }
 
 void fsp_gen_data_pkt(uint8_t *data, uint8_t data_len, uint8_t dst_adr, uint8_t ack, FSPPacket *fsp)
@@ -126,97 +130,118 @@ void fsp_encode(FSPPacket *fsp, uint8_t *pkt, uint8_t *pkt_len)
     *pkt_len = i;
 }
 
-uint8_t fsp_decode(uint8_t byte, FSPPacket *fsp)
+void fsp_decoder_init(FSPDecoder *decoder, uint8_t *frame)
+{
+    decoder->frame = frame;
+
+    fsp_decoder_reset(decoder);
+}
+
+void fsp_decoder_reset(FSPDecoder *decoder)
+{
+    decoder->pos = FSP_PKT_POS_SOD;
+    decoder->crc = FSP_CRC16_INITIAL_VALUE;
+}
+
+void fsp_decoder_set_frame(FSPDecoder *decoder, uint8_t *frame)
+{
+    decoder->frame = frame;
+}
+
+void fsp_decoder_view(FSPDecoder *decoder, FSPView *view)
+{
+    view->frame     = decoder->frame;
+    view->src_adr   = decoder->frame[FSP_PKT_POS_SRC_ADR];
+    view->dst_adr   = decoder->frame[FSP_PKT_POS_DST_ADR];
+    view->type      = decoder->frame[FSP_PKT_POS_TYPE];
+    view->offset    = FSP_PKT_POS_PAYLOAD;
+    view->length    = decoder->frame[FSP_PKT_POS_LEN];
+}
+
+uint8_t fsp_decoder_push(FSPDecoder *decoder, uint8_t byte)
 {
-    switch(fsp_decode_pos)
+    uint8_t *frame = decoder->frame;
+    uint16_t crc_pos = 0;
+
+    if (decoder->pos == FSP_PKT_POS_SOD)
     {
-        case FSP_PKT_POS_SOD:
-            if (byte == FSP_PKT_SOD)
-            {
-                fsp->sod = byte;
-                
-                fsp_decode_pos++;
-                
-                return FSP_PKT_NOT_READY;
-            }
-            else
-            {
-                return FSP_PKT_INVALID;
-            }
-        case FSP_PKT_POS_SRC_ADR:
-            fsp->src_adr = byte;
-            fsp_decode_pos++;
-            
-            return FSP_PKT_NOT_READY;
-        case FSP_PKT_POS_DST_ADR:
-            fsp->dst_adr = byte;
-            fsp_decode_pos++;
-            
-            if (byte == fsp_my_adr)
-            {
-                return FSP_PKT_NOT_READY;
-            }
-            else
-            {
-                return FSP_PKT_WRONG_ADR;
-            }
-        case FSP_PKT_POS_LEN:
-            if (byte > FSP_PAYLOAD_MAX_LENGTH)
-            {
-                fsp_decode_pos = FSP_PKT_POS_SOD;
-                
-                return FSP_PKT_INVALID;
-            }
-            else
-            {
-                fsp->length = byte;
-                fsp_decode_pos++;
-                
-                return FSP_PKT_NOT_READY;
-            }
-        case FSP_PKT_POS_TYPE:
-            fsp->type = byte;
-            fsp_decode_pos++;
-            
-            return FSP_PKT_NOT_READY;
-        default:
-            if (fsp_decode_pos < (FSP_PKT_POS_TYPE + fsp->length + 1))          // Payload
-            {
-                fsp->payload[fsp_decode_pos - FSP_PKT_POS_TYPE - 1] = byte;
-                fsp_decode_pos++;
-                
-                return FSP_PKT_NOT_READY;
-            }
-            else if (fsp_decode_pos == (FSP_PKT_POS_TYPE + fsp->length + 1))    // CRC16 MSB
-            {
-                fsp->crc16 = (uint16_t)(byte << 8);
-                
-                fsp_decode_pos++;
-                
-                return FSP_PKT_NOT_READY;
-            }
-            else if (fsp_decode_pos == (FSP_PKT_POS_TYPE + fsp->length + 2))    // CRC16 LSB
-            {
-                fsp->crc16 |= (uint16_t)(byte);
-                
-                fsp_decode_pos = FSP_PKT_POS_SOD;
-                
-                if (fsp->crc16 == crc16_CCITT(FSP_CRC16_INITIAL_VALUE, &fsp->src_adr, fsp->length + 4))
-                {
-                    return FSP_PKT_READY;
-                }
-                else
-                {
-                    return FSP_PKT_INVALID;
-                }
-            }
-            else
-            {
-                fsp_decode_pos = FSP_PKT_POS_SOD;
-                
-                return FSP_PKT_ERROR;
-            }
+        if (byte == FSP_PKT_SOD)
+        {
+            frame[FSP_PKT_POS_SOD] = byte;
+
+            decoder->crc = FSP_CRC16_INITIAL_VALUE;
+            decoder->pos++;
+        }
+
+        return FSP_PKT_NOT_READY;           // Other bytes are skipped while hunting a SOD
     }
+
+    frame[decoder->pos] = byte;
+
+    if ((decoder->pos == FSP_PKT_POS_LEN) && (byte > FSP_PAYLOAD_MAX_LENGTH))
+    {
+        // False SOD: hunts the next one from the header bytes after it
+        uint8_t header[3] = {frame[FSP_PKT_POS_SRC_ADR], frame[FSP_PKT_POS_DST_ADR], byte};
+        uint8_t i = 0;
+
+        decoder->pos = FSP_PKT_POS_SOD;
+
+        for(i=0; i<3; i++)
+        {
+            fsp_decoder_push(decoder, header[i]);
+        }
+
+        return FSP_PKT_INVALID;
+    }
+
+    if (decoder->pos < FSP_PKT_POS_PAYLOAD)
+    {
+        crc_pos = FSP_PKT_POS_PAYLOAD;      // The length is not known yet
+    }
+    else
+    {
+        crc_pos = FSP_PKT_POS_PAYLOAD + frame[FSP_PKT_POS_LEN];
+    }
+
+    if (decoder->pos < crc_pos)                 // Header and payload
+    {
+        decoder->crc = fsp_crc16_update(decoder->crc, byte);
+        decoder->pos++;
+
+        return FSP_PKT_NOT_READY;
+    }
+    else if (decoder->pos == crc_pos)           // CRC16 MSB
+    {
+        decoder->pos++;
+
+        return FSP_PKT_NOT_READY;
+    }
+
+    // CRC16 LSB
+    decoder->pos = FSP_PKT_POS_SOD;
+
+    // The CRC16 of the header and the payload was computed as they arrived
+    if ((((uint16_t)frame[crc_pos] << 8) | byte) != decoder->crc)
+    {
+        return FSP_PKT_INVALID;
+    }
+
+    return (frame[FSP_PKT_POS_DST_ADR] == fsp_my_adr)? FSP_PKT_READY : FSP_PKT_WRONG_ADR;
+}
+
+uint8_t fsp_decoder_read(FSPDecoder *decoder, const uint8_t *data, uint16_t len, uint16_t *consumed)
+{
+    uint8_t state = FSP_PKT_NOT_READY;
+    uint16_t i = 0;
+
+    while((i < len) && (state == FSP_PKT_NOT_READY))
+    {
+        state = fsp_decoder_push(decoder, data[i++]);
+    }
+
+    *consumed = i;
+
+    return state;
 }
 
 //! \} End of fsp group
@@ -45,6 +45,7 @@
 #define FSP_PKT_POS_DST_ADR             2       /**< Destination address byte position. */
 #define FSP_PKT_POS_LEN                 3       /**< Length byte position. */
 #define FSP_PKT_POS_TYPE                4       /**< Type byte position. */
+#define FSP_PKT_POS_PAYLOAD             5       /**< First payload byte position. */
 
 // Start Of Data byte
 #define FSP_PKT_SOD                     0x7E    /**< Star-of-data byte. */
@@ -75,6 +76,7 @@
 // Max. lengths
 #define FSP_PKT_MAX_LENGTH              256     /**< Packet maximum length (in bytes). */
 #define FSP_PAYLOAD_MAX_LENGTH          252     /**< Payload maximum length (in bytes). */
+#define FSP_FRAME_MAX_LENGTH            (FSP_PKT_POS_PAYLOAD + FSP_PAYLOAD_MAX_LENGTH + 2)  /**< Received frame maximum length (in bytes). */
 
 // CRC16 initial value (or seed byte)
 #define FSP_CRC16_INITIAL_VALUE         0       /**< CRC16 initial value. */
@@ -110,9 +112,30 @@ typedef struct
 extern uint8_t fsp_my_adr;
 
 /**
- * \brief Decode byte position (From the internal "state machine").
+ * \brief FSP decoder of a link.
+ * 
+ * Each link has its own decoder, so a packet can be received over any number of calls. The frame is stored as
+ * received in a contiguous buffer of the caller, and the payload is used in place (see FSPView).
+ */
+typedef struct
+{
+    uint16_t pos;                               /**< Position of the next byte in the frame (FSP_PKT_POS_SOD while hunting a SOD). */
+    uint16_t crc;                               /**< CRC16 of the bytes decoded so far. */
+    uint8_t *frame;                             /**< Receive buffer (FSP_FRAME_MAX_LENGTH bytes). */
+} FSPDecoder;
+
+/**
+ * \brief View of a received packet (in the receive buffer of a decoder).
  */
-extern uint8_t fsp_decode_pos;
+typedef struct
+{
+    uint8_t *frame;                             /**< Received frame. */
+    uint8_t src_adr;                            /**< Source address. */
+    uint8_t dst_adr;                            /**< Destination address. */
+    uint8_t type;                               /**< Type of packet. */
+    uint16_t offset;                            /**< Position of the payload in the frame. */
+    uint8_t length;                             /**< Length of the payload. */
+} FSPView;
 
 /**
  * \brief Initializes the FSP library.
@@ -123,13 +146,6 @@ extern uint8_t fsp_decode_pos;
  */
 void fsp_init(uint8_t module_adr);
 
-/**
- * \brief Resets the FSP internal state machine (The position counter) for decoding.
- * 
- * \return None.
- */
-void fsp_reset();
-
 /**
  * \brief Generates a FSP data packet.
  * 
@@ -203,20 +219,75 @@ void fsp_gen_pkt(uint8_t *payload, uint8_t payload_len, uint8_t dst_adr, uint8_t
 void fsp_encode(FSPPacket *fsp, uint8_t *pkt, uint8_t *pkt_len);
 
 /**
- * \brief Decodes a array with the FSP packet into a FSPPacket struct.
+ * \brief Initializes a FSP decoder (hunting a SOD).
+ * 
+ * \param decoder is a pointer to a FSPDecoder struct.
+ * \param frame is the receive buffer (FSP_FRAME_MAX_LENGTH bytes).
+ * 
+ * \return None.
+ */
+void fsp_decoder_init(FSPDecoder *decoder, uint8_t *frame);
+
+/**
+ * \brief Replaces the receive buffer of a FSP decoder.
+ * 
+ * Used after FSP_PKT_READY to keep the received frame: the next frame is received in the new buffer.
  * 
- * \param byte is the incoming byte from a FSP packet.
- * \param fsp is a pointer to a FSPPacket struct to store the packet data.
+ * \param decoder is a pointer to a FSPDecoder struct.
+ * \param frame is the new receive buffer (FSP_FRAME_MAX_LENGTH bytes).
+ * 
+ * \return None.
+ */
+void fsp_decoder_set_frame(FSPDecoder *decoder, uint8_t *frame);
+
+/**
+ * \brief Returns a view of the last received packet.
+ * 
+ * \param decoder is a pointer to a FSPDecoder struct (after FSP_PKT_READY or FSP_PKT_WRONG_ADR).
+ * \param view is a pointer to a FSPView struct to store the view.
+ * 
+ * \return None.
+ */
+void fsp_decoder_view(FSPDecoder *decoder, FSPView *view);
+
+/**
+ * \brief Drops the packet being received by a FSP decoder.
+ * 
+ * \param decoder is a pointer to a FSPDecoder struct.
+ * 
+ * \return None.
+ */
+void fsp_decoder_reset(FSPDecoder *decoder);
+
+/**
+ * \brief Decodes one byte of a FSP byte stream.
+ * 
+ * The bytes before a SOD are skipped. After an invalid packet the decoder hunts the next SOD (from the bytes after
+ * the false SOD if the header is invalid).
+ * 
+ * \param decoder is a pointer to a FSPDecoder struct.
+ * \param byte is the incoming byte.
  * 
  * \return The state of the decoding process. It can be:
  *              - FSP_PKT_NOT_READY when all the packet data were not received yet.
- *              - FSP_PKT_READY when the packet is ready to be used and the decoding process is over.
- *              - FSP_PKT_INVALID when an invalid packet was received.
- *              - FSP_PKT_WRONG_ADR when the destination address of the packet is not equal to host address.
- *              - FSP_PKT_ERROR when an error occurs during the decoding process.
+ *              - FSP_PKT_READY when a packet to this module was received (see fsp_decoder_view).
+ *              - FSP_PKT_INVALID when an invalid packet (length or CRC16) was dropped.
+ *              - FSP_PKT_WRONG_ADR when a valid packet to another module was received.
  *              .
  */
-uint8_t fsp_decode(uint8_t byte, FSPPacket *fsp);
+uint8_t fsp_decoder_push(FSPDecoder *decoder, uint8_t byte);
+
+/**
+ * \brief Decodes a FSP byte stream up to the end of the next packet.
+ * 
+ * \param decoder is a pointer to a FSPDecoder struct.
+ * \param data is the stream.
+ * \param len is the length of the stream.
+ * \param consumed is the number of bytes of the stream that were decoded (the remaining ones belong to the next calls).
+ * 
+ * \return The state of the decoding process after the last consumed byte (see fsp_decoder_push).
+ */
+uint8_t fsp_decoder_read(FSPDecoder *decoder, const uint8_t *data, uint16_t len, uint16_t *consumed);
 
 #endif // FSP_H_
 
@@ -0,0 +1,225 @@
+/*
+ * kiss.c
+ *
+ * Copyright (C) 2017, Federal University of Santa Catarina.
+ *
+ * This file is part of FloripaSat-Beacon.
+ *
+ * FloripaSat-Beacon is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-Beacon is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-Beacon. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief KISS framing implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \addtogroup kiss
+ * \{
+ */
+
+#include "kiss.h"
+
+#define KISS_STATE_IDLE                 0   /**< Waiting the first FEND. */
+#define KISS_STATE_TYPE                 1   /**< Waiting the type byte. */
+#define KISS_STATE_DATA                 2   /**< Receiving the data. */
+#define KISS_STATE_DROP                 3   /**< Invalid frame, waiting the next FEND. */
+
+uint16_t kiss_escape(const uint8_t *data, uint16_t len, uint8_t *out)
+{
+    uint16_t out_len = 0;
+    uint16_t i = 0;
+
+    for(i=0; i<len; i++)
+    {
+        if (data[i] == KISS_FEND)
+        {
+            out[out_len++] = KISS_FESC;
+            out[out_len++] = KISS_TFEND;
+        }
+        else if (data[i] == KISS_FESC)
+        {
+            out[out_len++] = KISS_FESC;
+            out[out_len++] = KISS_TFESC;
+        }
+        else
+        {
+            out[out_len++] = data[i];
+        }
+    }
+
+    return out_len;
+}
+
+uint16_t kiss_encode(uint8_t type, const uint8_t *data, uint16_t len, uint8_t *frame)
+{
+    uint16_t frame_len = 0;
+
+    frame[frame_len++] = KISS_FEND;
+    frame_len += kiss_escape(&type, 1, &frame[frame_len]);
+    frame_len += kiss_escape(data, len, &frame[frame_len]);
+    frame[frame_len++] = KISS_FEND;
+
+    return frame_len;
+}
+
+void kiss_decoder_init(KISS_Decoder *decoder, uint8_t *data, uint16_t size)
+{
+    decoder->data   = data;
+    decoder->size   = size;
+    decoder->len    = 0;
+    decoder->type   = 0;
+    decoder->state  = KISS_STATE_IDLE;
+    decoder->escape = 0;
+}
+
+uint8_t kiss_decode(KISS_Decoder *decoder, uint8_t byte)
+{
+    uint8_t state = KISS_DECODE_PREFAIL;
+
+    if (byte == KISS_FEND)
+    {
+        // A FEND ends the current frame and starts the next one (an aborted escape sequence drops the frame)
+        if ((decoder->state == KISS_STATE_DATA) && !decoder->escape)
+        {
+            state = KISS_DECODE_OK;
+        }
+        else if ((decoder->state == KISS_STATE_DROP) || decoder->escape)
+        {
+            state = KISS_DECODE_FAIL;
+        }
+
+        decoder->state  = KISS_STATE_TYPE;
+        decoder->escape = 0;
+
+        return state;
+    }
+
+    if ((decoder->state == KISS_STATE_IDLE) || (decoder->state == KISS_STATE_DROP))
+    {
+        return state;
+    }
+
+    if (decoder->escape)
+    {
+        decoder->escape = 0;
+
+        if (byte == KISS_TFEND)
+        {
+            byte = KISS_FEND;
+        }
+        else if (byte == KISS_TFESC)
+        {
+            byte = KISS_FESC;
+        }
+        else
+        {
+            decoder->state = KISS_STATE_DROP;
+
+            return state;
+        }
+    }
+    else if (byte == KISS_FESC)
+    {
+        decoder->escape = 1;
+
+        return state;
+    }
+
+    if (decoder->state == KISS_STATE_TYPE)
+    {
+        decoder->type   = byte;
+        decoder->len    = 0;
+        decoder->state  = KISS_STATE_DATA;
+    }
+    else if (decoder->len < decoder->size)
+    {
+        decoder->data[decoder->len++] = byte;
+    }
+    else
+    {
+        decoder->state = KISS_STATE_DROP;
+    }
+
+    return state;
+}
+
+void kiss_receiver_init(KISS_Receiver *receiver, uint8_t type, uint8_t *buffer0, uint8_t *buffer1, uint16_t size)
+{
+    receiver->buffer[0] = buffer0;
+    receiver->buffer[1] = buffer1;
+    receiver->type      = type;
+    receiver->ready     = 0;
+    receiver->len       = 0;
+    receiver->pos       = 0;
+
+    kiss_decoder_init(&receiver->decoder, buffer1, size);
+}
+
+uint8_t kiss_receiver_push(KISS_Receiver *receiver, uint8_t byte)
+{
+    uint8_t state = kiss_decode(&receiver->decoder, byte);
+
+    if ((state == KISS_DECODE_OK) && (receiver->decoder.type == receiver->type) && (receiver->decoder.len > 0) &&
+        (receiver->len == 0))
+    {
+        // The finished frame becomes the last received one, and the released buffer receives the next frame
+        receiver->ready = 1 - receiver->ready;
+        receiver->len = receiver->decoder.len;
+        receiver->decoder.data = receiver->buffer[1 - receiver->ready];
+    }
+
+    return state;
+}
+
+uint16_t kiss_receiver_available(KISS_Receiver *receiver)
+{
+    uint16_t len = receiver->len;
+
+    return (len > 0)? len - receiver->pos : 0;
+}
+
+uint16_t kiss_receiver_read(KISS_Receiver *receiver, uint8_t *data, uint16_t len)
+{
+    const uint8_t *frame = receiver->buffer[receiver->ready];
+    uint16_t available = kiss_receiver_available(receiver);
+    uint16_t i = 0;
+
+    if (len > available)
+    {
+        len = available;
+    }
+
+    for(i=0; i<len; i++)
+    {
+        data[i] = frame[receiver->pos + i];
+    }
+
+    receiver->pos += len;
+
+    // The buffer is released after the last byte of the frame
+    if ((len > 0) && (receiver->pos == receiver->len))
+    {
+        receiver->pos = 0;
+        receiver->len = 0;
+    }
+
+    return len;
+}
+
+//! \} End of kiss group
@@ -0,0 +1,209 @@
+/*
+ * kiss.h
+ *
+ * Copyright (C) 2017, Federal University of Santa Catarina.
+ *
+ * This file is part of FloripaSat-Beacon.
+ *
+ * FloripaSat-Beacon is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-Beacon is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-Beacon. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief KISS framing (host-TNC byte stream protocol).
+ *
+ * Each frame is a FEND, a type byte (port in the high nibble, command in the low nibble), the data and a FEND.
+ * FEND and FESC bytes of the type and data are sent as FESC TFEND and FESC TFESC.
+ *
+ * The encoder and the decoder have no I/O, so the same code runs in the UART radio simulator and in the host tools.
+ *
+ * \see M. Chepponis, P. Karn. The KISS TNC: A simple Host-to-TNC communications protocol. 1987.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \defgroup kiss KISS
+ * \ingroup src
+ * \{
+ */
+
+#ifndef KISS_H_
+#define KISS_H_
+
+#include <stdint.h>
+
+/**
+ * \brief Special characters.
+ */
+#define KISS_FEND                       0xC0        /**< Frame end. */
+#define KISS_FESC                       0xDB        /**< Frame escape. */
+#define KISS_TFEND                      0xDC        /**< Transposed frame end. */
+#define KISS_TFESC                      0xDD        /**< Transposed frame escape. */
+
+/**
+ * \brief Commands (low nibble of the type byte).
+ */
+#define KISS_CMD_DATA                   0x00        /**< Data frame. */
+#define KISS_CMD_TX_DELAY               0x01        /**< Transmitter keyup delay (10 ms units). */
+#define KISS_CMD_PERSISTENCE            0x02        /**< Persistence parameter (CSMA). */
+#define KISS_CMD_SLOT_TIME              0x03        /**< Slot interval (10 ms units). */
+#define KISS_CMD_TX_TAIL                0x04        /**< Time to hold up the TX after the frame (10 ms units). */
+#define KISS_CMD_FULL_DUPLEX            0x05        /**< Full duplex (1) or half duplex (0). */
+#define KISS_CMD_SET_HARDWARE           0x06        /**< TNC specific configuration. */
+#define KISS_CMD_RETURN                 0xFF        /**< Exit KISS mode (the whole type byte, not a command of a port). */
+
+/**
+ * \brief Type byte of a frame.
+ */
+#define KISS_TYPE(port, cmd)            ((uint8_t)(((port) << 4) | ((cmd) & 0x0F)))
+
+/**
+ * \brief Maximum length of an encoded frame with len data bytes (every byte escaped).
+ */
+#define KISS_FRAME_MAX_LEN(len)         (2*(len) + 4)
+
+/**
+ * \brief Decodification states.
+ */
+#define KISS_DECODE_OK                  0   /**< A frame was received. */
+#define KISS_DECODE_FAIL                1   /**< A frame was dropped (too long or with an invalid escape sequence). */
+#define KISS_DECODE_PREFAIL             2   /**< No frame was finished. */
+
+/**
+ * \brief Frame decoder state.
+ */
+typedef struct
+{
+    uint8_t *data;                      /**< Buffer of the data of the frame being received. */
+    uint16_t size;                      /**< Size of the buffer. */
+    uint16_t len;                       /**< Number of data bytes received. */
+    uint8_t type;                       /**< Type byte of the frame. */
+    uint8_t state;                      /**< Position in the frame (outside, type byte, data, dropping). */
+    uint8_t escape;                     /**< The last byte was a FESC. */
+} KISS_Decoder;
+
+/**
+ * \brief Double buffered frame receiver (bytes pushed from an ISR, frames read from the main loop).
+ */
+typedef struct
+{
+    KISS_Decoder decoder;               /**< Decoder of the frame being received. */
+    uint8_t *buffer[2];                 /**< Frame being received and last received frame. */
+    uint8_t type;                       /**< Type byte of the accepted frames. */
+    volatile uint8_t ready;             /**< Buffer of the last received frame. */
+    volatile uint16_t len;              /**< Length of the last received frame (0 = released). */
+    uint16_t pos;                       /**< Number of bytes of the last received frame already read. */
+} KISS_Receiver;
+
+/**
+ * \brief Escapes a block of the data of a frame.
+ *
+ * \param data is the data.
+ * \param len is the length of data.
+ * \param out is the array to store the escaped bytes (up to 2*len bytes).
+ *
+ * \return The number of bytes written to out.
+ */
+uint16_t kiss_escape(const uint8_t *data, uint16_t len, uint8_t *out);
+
+/**
+ * \brief Encodes a frame.
+ *
+ * \param type is the type byte (KISS_TYPE(port, cmd)).
+ * \param data is the data of the frame.
+ * \param len is the length of data.
+ * \param frame is the array to store the frame (up to KISS_FRAME_MAX_LEN(len) bytes).
+ *
+ * \return The length of the frame.
+ */
+uint16_t kiss_encode(uint8_t type, const uint8_t *data, uint16_t len, uint8_t *frame);
+
+/**
+ * \brief Decoder initialization.
+ *
+ * \param decoder is the decoder state.
+ * \param data is the buffer to store the data of the received frames.
+ * \param size is the size of the buffer (longer frames are dropped).
+ *
+ * \return None.
+ */
+void kiss_decoder_init(KISS_Decoder *decoder, uint8_t *data, uint16_t size);
+
+/**
+ * \brief Pushes a received byte into the decoder.
+ *
+ * When a frame is finished, its type byte is in decoder->type and its data in decoder->data (decoder->len bytes),
+ * until the next byte is pushed. Empty frames (consecutive FENDs) are ignored.
+ *
+ * \param decoder is the decoder state.
+ * \param byte is the received byte.
+ *
+ * \return The decodification state (KISS_DECODE_PREFAIL if no frame was finished).
+ */
+uint8_t kiss_decode(KISS_Decoder *decoder, uint8_t byte);
+
+/**
+ * \brief Receiver initialization.
+ *
+ * \param receiver is the receiver state.
+ * \param type is the type byte of the accepted frames (the other ones are ignored).
+ * \param buffer0 is the first frame buffer.
+ * \param buffer1 is the second frame buffer.
+ * \param size is the size of each buffer (longer frames are dropped).
+ *
+ * \return None.
+ */
+void kiss_receiver_init(KISS_Receiver *receiver, uint8_t type, uint8_t *buffer0, uint8_t *buffer1, uint16_t size);
+
+/**
+ * \brief Pushes a received byte into the receiver.
+ *
+ * A finished frame becomes the last received frame, unless the previous one was not read to the end yet (the new
+ * frame is dropped then).
+ *
+ * \param receiver is the receiver state.
+ * \param byte is the received byte.
+ *
+ * \return The decodification state of kiss_decode.
+ */
+uint8_t kiss_receiver_push(KISS_Receiver *receiver, uint8_t byte);
+
+/**
+ * \brief Returns the number of bytes of the last received frame not read yet.
+ *
+ * \param receiver is the receiver state.
+ *
+ * \return The number of unread bytes (0 if there is no frame).
+ */
+uint16_t kiss_receiver_available(KISS_Receiver *receiver);
+
+/**
+ * \brief Reads the next bytes of the last received frame.
+ *
+ * The frame can be read in several calls. Its buffer is released for the next frame after its last byte is read.
+ *
+ * \param receiver is the receiver state.
+ * \param data is an array to store the bytes.
+ * \param len is the maximum number of bytes to read.
+ *
+ * \return The number of bytes read.
+ */
+uint16_t kiss_receiver_read(KISS_Receiver *receiver, uint8_t *data, uint16_t len);
+
+#endif // KISS_H_
+
+//! \} End of kiss group
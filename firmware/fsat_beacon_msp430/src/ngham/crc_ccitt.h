@@ -42,22 +42,22 @@
 #include <stdint.h>
 
 /**
- * \brief 
+ * \brief Feeds one byte to a CRC-CCITT computation (CRC-16/X-25 register, see crc16_x25).
  * 
- * \param buf
- * \param crc
+ * \param buf is the byte.
+ * \param crc is the current register (0xFFFF at the start).
  * 
- * \return 
+ * \return The updated register (not inverted).
  */
 uint16_t ngham_CRC_CCITTByte(uint8_t buf, uint16_t crc);
 
 /**
- * \brief 
+ * \brief Computes the CRC-CCITT (CRC-16/X-25) value of an array of data.
  * 
- * \param *buf
- * \param buf_len
+ * \param buf is the data.
+ * \param buf_len is the length of the data.
  * 
- * \return 
+ * \return The CRC value of the data.
  */
 uint16_t ngham_CRC_CCITT(uint8_t *buf, uint16_t buf_len);
 
@@ -35,30 +35,17 @@
  * \{
  */
 
-#include <stdlib.h>
 #include <string.h>
 
 #include "fec.h"
 
-void free_rs_char(RS *rs_ptr)
+void encode_rs_char(const RS *rs_ptr, uint8_t *data, uint8_t *parity)
 {
-    free(rs_ptr->alpha_to);
-    free(rs_ptr->index_of);
-    free(rs_ptr->genpoly);
-    free(rs_ptr);
-}
-
-void encode_rs_char(RS *rs_ptr, uint8_t *data, uint8_t *parity)
-{
-    //int16_t i, j;
-    //uint8_t feedback;
+    int16_t i, j;
+    uint8_t feedback;
 
     memset(parity, 0, rs_ptr->nroots*sizeof(uint8_t));
-    
-    // *******************************
-    // -- TO FIX ---------------------
-    // *******************************
-    /*
+
     for(i=0; i<(int16_t)(rs_ptr->nn - rs_ptr->nroots - rs_ptr->pad); i++)
     {
         feedback = rs_ptr->index_of[data[i] ^ parity[0]];
@@ -66,66 +53,62 @@ void encode_rs_char(RS *rs_ptr, uint8_t *data, uint8_t *parity)
         {
             for(j=1; j<rs_ptr->nroots; j++)
             {
-                parity[j] ^= rs_ptr->alpha_to[modnn(rs_ptr, feedback + rs_ptr->genpoly[rs_ptr->nroots-j])];
+                parity[j] ^= rs_ptr->alpha_to[feedback + rs_ptr->genpoly[rs_ptr->nroots-j]];
             }
         }
         // Shift
         memmove(&parity[0], &parity[1], sizeof(uint8_t)*(rs_ptr->nroots-1));
-        
+
         if (feedback != rs_ptr->nn)
         {
-            parity[rs_ptr->nroots-1] = rs_ptr->alpha_to[modnn(rs_ptr, feedback + rs_ptr->genpoly[0])];
+            parity[rs_ptr->nroots-1] = rs_ptr->alpha_to[feedback + rs_ptr->genpoly[0]];
         }
         else
         {
             parity[rs_ptr->nroots-1] = 0;
         }
     }
-    */
 }
 
-int16_t decode_rs_char(RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_eras)
+int16_t decode_rs_char(const RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_eras)
 {
     int16_t retval;
  
     int16_t deg_lambda, el, deg_omega;
     int16_t i, j, r, k;
     uint8_t u, q, tmp, num1, num2, den, discr_r;
-    //uint8_t lambda[rs_ptr->nroots + 1], s[rs_ptr->nroots];      // Err+Eras Locator poly and syndrome poly
-    //uint8_t b[rs_ptr->nroots + 1], t[rs_ptr->nroots + 1], omega[rs_ptr->nroots + 1];
-    //uint8_t root[rs_ptr->nroots], reg[rs_ptr->nroots + 1], loc[rs_ptr->nroots];
-    uint8_t lambda[10], s[10];              // Err+Eras Locator poly and syndrome poly
-    uint8_t b[10], t[10], omega[10];
-    uint8_t root[10], reg[10], loc[10];
+    uint8_t lambda[FEC_MAX_NROOTS + 1], s[FEC_MAX_NROOTS];     // Err+Eras Locator poly and syndrome poly
+    uint8_t b[FEC_MAX_NROOTS + 1], t[FEC_MAX_NROOTS + 1], omega[FEC_MAX_NROOTS + 1];
+    uint8_t root[FEC_MAX_NROOTS], reg[FEC_MAX_NROOTS + 1], loc[FEC_MAX_NROOTS];
     int16_t syn_error, count;
+    int16_t len = rs_ptr->nn - rs_ptr->pad;
 
-    // form the syndromes; i.e., evaluate data(x) at roots of g(x)
-    for(i=0; i<rs_ptr->nroots; i++)
+    if (rs_ptr->nroots > FEC_MAX_NROOTS)
     {
-        s[i] = data[0];
+        return -1;
     }
 
-    for(j=1; j<(rs_ptr->nn - rs_ptr->pad); j++)
+    // form the syndromes; i.e., evaluate data(x) at roots of g(x) with Horner's method (one root at a time)
+    syn_error = 0;
+    for(i=0; i<rs_ptr->nroots; i++)
     {
-        for(i=0; i<rs_ptr->nroots; i++)
+        uint8_t syn = data[0];
+        uint8_t syn_root = fec_syn_root[i];     // alpha**((fcr+i)*prim), index form
+
+        for(j=1; j<len; j++)
         {
-            if (s[i] == 0)
+            if (syn == 0)
             {
-                s[i] = data[j];
+                syn = data[j];
             }
             else
             {
-                s[i] = data[j] ^ rs_ptr->alpha_to[modnn(rs_ptr, rs_ptr->index_of[s[i]] + (rs_ptr->fcr + i)*rs_ptr->prim)];
+                syn = data[j] ^ rs_ptr->alpha_to[rs_ptr->index_of[syn] + syn_root];
             }
         }
-    }
 
-    // Convert syndromes to index form, checking for nonzero condition
-    syn_error = 0;
-    for(i=0; i<rs_ptr->nroots; i++)
-    {
-        syn_error |= s[i];
-        s[i] = rs_ptr->index_of[s[i]];
+        syn_error |= syn;
+        s[i] = syn;
     }
 
     if (!syn_error)
@@ -133,24 +116,30 @@ int16_t decode_rs_char(RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_
         /* if syndrome is zero, data[] is a codeword and there are no
         * errors to correct. So return data[] unmodified
         */
-        count = 0;
-        goto finish;
+        return 0;
+    }
+
+    // Convert syndromes to index form
+    for(i=0; i<rs_ptr->nroots; i++)
+    {
+        s[i] = rs_ptr->index_of[s[i]];
     }
+
     memset(&lambda[1], 0, rs_ptr->nroots*sizeof(lambda[0]));
     lambda[0] = 1;
 
     if (no_eras > 0)
     {
         // Init lambda to be the erasure locator polynomial
-        lambda[1] = rs_ptr->alpha_to[modnn(rs_ptr, rs_ptr->prim*(rs_ptr->nn-1-eras_pos[0]))];
+        lambda[1] = rs_ptr->alpha_to[FEC_FOLD(rs_ptr->prim*(rs_ptr->nn-1-eras_pos[0]))];
         for(i=1; i<no_eras; i++)
         {
-            u = modnn(rs_ptr, rs_ptr->prim*(rs_ptr->nn - 1 - eras_pos[i]));
+            u = FEC_MODNN(FEC_FOLD(rs_ptr->prim*(rs_ptr->nn - 1 - eras_pos[i])));
             for(j=i+1; j>0; j--)
             {
                 tmp = rs_ptr->index_of[lambda[j - 1]];
                 if (tmp != rs_ptr->nn)
-                    lambda[j] ^= rs_ptr->alpha_to[modnn(rs_ptr, u + tmp)];
+                    lambda[j] ^= rs_ptr->alpha_to[u + tmp];
             }
         }
     }
@@ -168,7 +157,7 @@ int16_t decode_rs_char(RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_
         {
             if ((lambda[i] != 0) && (s[r-i-1] != rs_ptr->nn))
             {
-                discr_r ^= rs_ptr->alpha_to[modnn(rs_ptr, rs_ptr->index_of[lambda[i]] + s[r-i-1])];
+                discr_r ^= rs_ptr->alpha_to[rs_ptr->index_of[lambda[i]] + s[r-i-1]];
             }
         }
         discr_r = rs_ptr->index_of[discr_r];    // Index form
@@ -185,7 +174,7 @@ int16_t decode_rs_char(RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_
             for(i=0; i<rs_ptr->nroots; i++)
             {
                 if(b[i] != rs_ptr->nn)
-                    t[i+1] = lambda[i+1] ^ rs_ptr->alpha_to[modnn(rs_ptr, discr_r + b[i])];
+                    t[i+1] = lambda[i+1] ^ rs_ptr->alpha_to[discr_r + b[i]];
                 else
                     t[i+1] = lambda[i+1];
             }
@@ -196,7 +185,7 @@ int16_t decode_rs_char(RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_
                 // 2 lines below: B(x) <-- inv(discr_r) * lambda(x)
                 for(i=0; i<=rs_ptr->nroots; i++)
                 {
-                    b[i] = (lambda[i] == 0) ? rs_ptr->nn : modnn(rs_ptr, rs_ptr->index_of[lambda[i]] - discr_r + rs_ptr->nn);
+                    b[i] = (lambda[i] == 0) ? rs_ptr->nn : FEC_MODNN(rs_ptr->index_of[lambda[i]] - discr_r + rs_ptr->nn);
                 }
             }
             else
@@ -220,21 +209,21 @@ int16_t decode_rs_char(RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_
     // Find roots of the error+erasure locator polynomial by Chien search
     memcpy(&reg[1], &lambda[1], rs_ptr->nroots*sizeof(reg[0]));
     count = 0;      // Number of roots of lambda(x)
-    for(i=1, k=rs_ptr->iprim-1; i<=rs_ptr->nn; i++, k=modnn(rs_ptr, k + rs_ptr->iprim))
+    for(i=1, k=rs_ptr->iprim-1; i<=rs_ptr->nn; i++, k=FEC_MODNN(k + rs_ptr->iprim))
     {
         q = 1;  // lambda[0] is always 0
         for(j=deg_lambda; j>0; j--)
         {
             if (reg[j] != rs_ptr->nn)
             {
-                reg[j] = modnn(rs_ptr, reg[j] + j);
+                reg[j] = FEC_MODNN(reg[j] + j);
                 q ^= rs_ptr->alpha_to[reg[j]];
             }
         }
         if (q != 0)
             continue;   // Not a root
-        // store root (index-form) and error location number
-        root[count] = i;
+        // store root (index-form, i = nn is alpha**0) and error location number
+        root[count] = FEC_MODNN(i);
         loc[count] = k;
         /* If we've already found max possible roots,
         * abort the search to save time
@@ -257,7 +246,7 @@ int16_t decode_rs_char(RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_
         for(j=i; j>=0; j--)
         {
             if ((s[i - j] != rs_ptr->nn) && (lambda[j] != rs_ptr->nn))
-                tmp ^= rs_ptr->alpha_to[modnn(rs_ptr, s[i - j] + lambda[j])];
+                tmp ^= rs_ptr->alpha_to[s[i - j] + lambda[j]];
         }
         omega[i] = rs_ptr->index_of[tmp];
     }
@@ -265,26 +254,28 @@ int16_t decode_rs_char(RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_
     // Compute error values in poly-form. num1 = omega(inv(X(l))), num2 = inv(X(l))**(FCR-1) and den = lambda_pr(inv(X(l))) all in poly-form
     for(j=count-1; j>=0; j--)
     {
+        // i*root[j] is accumulated modulo nn instead of being multiplied and reduced on every term
         num1 = 0;
-        for(i=deg_omega; i>=0; i--)
+        for(i=0, k=0; i<=deg_omega; i++, k=FEC_MODNN(k + root[j]))
         {
             if (omega[i] != rs_ptr->nn)
-                num1  ^= rs_ptr->alpha_to[modnn(rs_ptr, omega[i] + i * root[j])];
+                num1  ^= rs_ptr->alpha_to[omega[i] + k];
         }
-        num2 = rs_ptr->alpha_to[modnn(rs_ptr, root[j] * (rs_ptr->fcr - 1) + rs_ptr->nn)];
+        num2 = rs_ptr->alpha_to[FEC_FOLD(root[j] * (rs_ptr->fcr - 1))];
         den = 0;
+        u = FEC_MODNN(2*root[j]);
 
         // lambda[i+1] for i even is the formal derivative lambda_pr of lambda[i]
-        for(i=MIN(deg_lambda, rs_ptr->nroots-1) & ~1; i>=0; i-=2)
+        for(i=0, k=0; i<=(MIN(deg_lambda, rs_ptr->nroots-1) & ~1); i+=2, k=FEC_MODNN(k + u))
         {
             if (lambda[i+1] != rs_ptr->nn)
-                den ^= rs_ptr->alpha_to[modnn(rs_ptr, lambda[i+1] + i * root[j])];
+                den ^= rs_ptr->alpha_to[lambda[i+1] + k];
         }
 
         // Apply error to data
         if (num1 != 0 && loc[j] >= rs_ptr->pad)
         {
-            data[loc[j] - rs_ptr->pad] ^= rs_ptr->alpha_to[modnn(rs_ptr, rs_ptr->index_of[num1] + rs_ptr->index_of[num2] + rs_ptr->nn - rs_ptr->index_of[den])];
+            data[loc[j] - rs_ptr->pad] ^= rs_ptr->alpha_to[FEC_MODNN(rs_ptr->index_of[num1] + rs_ptr->index_of[num2]) + rs_ptr->nn - rs_ptr->index_of[den]];
         }
     }
 finish:
@@ -300,15 +291,4 @@ finish:
     return retval;
 }
 
-int16_t modnn(RS *rs_ptr, int16_t x)
-{    
-    while(x >= rs_ptr->nn)
-    {
-        x -= rs_ptr->nn;
-        x = (x >> rs_ptr->mm) + (x & rs_ptr->nn);
-    }
-    
-    return x;
-}
-
 //! \} End of fec implementation group
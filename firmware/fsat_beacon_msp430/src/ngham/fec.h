@@ -43,16 +43,33 @@
 
 #define	MIN(a, b)   ((a) < (b) ? (a) : (b))
 
+/**
+ * \brief Reed-Solomon code parameters used by NGHam.
+ * 
+ * The lookup tables below are generated from these values by host/tools/fec_tables_gen.c.
+ */
+#define FEC_MM                          8       /**< Bits per symbol. */
+#define FEC_NN                          255     /**< Symbols per block (= (1 << FEC_MM)-1). */
+#define FEC_GFPOLY                      0x187   /**< Field generator polynomial. */
+#define FEC_FCR                         112     /**< First consecutive root, index form. */
+#define FEC_PRIM                        11      /**< Primitive element, index form. */
+#define FEC_IPRIM                       116     /**< prim-th root of 1, index form. */
+#define FEC_NROOTS_SHORT                16      /**< Parity symbols of the three smaller NGHam sizes. */
+#define FEC_NROOTS_LONG                 32      /**< Parity symbols of the four larger NGHam sizes. */
+#define FEC_MAX_NROOTS                  FEC_NROOTS_LONG /**< Size of the decoder work buffers. */
+
 /**
  * \brief Reed-Solomon codec control block.
+ * 
+ * The control blocks are compile-time constants pointing to the tables of fec_tables.c.
  */
 typedef struct
 {
     uint16_t mm;            /**< Bits per symbol. */
     uint16_t nn;            /**< Symbols per block (= (1 << mm)-1). */
-    uint8_t *alpha_to;      /**< log lookup table. */
-    uint8_t *index_of;      /**< Antilog lookup table. */
-    uint8_t *genpoly;       /**< Generator polynomial. */
+    const uint8_t *alpha_to;    /**< log lookup table. */
+    const uint8_t *index_of;    /**< Antilog lookup table. */
+    const uint8_t *genpoly;     /**< Generator polynomial. */
     uint16_t nroots;        /**< Number of generator roots = number of parity symbols. */
     uint16_t fcr;           /**< First consecutive root, index form. */
     uint16_t prim;          /**< Primitive element, index form. */
@@ -60,21 +77,48 @@ typedef struct
     uint16_t pad;           /**< Padding bytes in shortened block. */
 } RS;
 
+extern const uint8_t fec_alpha_to[2*FEC_NN];               /**< Antilog table (index form to polynomial form), repeated twice so any sum of two indexes is a single lookup. */
+extern const uint8_t fec_index_of[FEC_NN+1];                /**< Log table (polynomial form to index form). */
+extern const uint8_t fec_genpoly_16[FEC_NROOTS_SHORT+1];    /**< Generator polynomial with 16 roots, index form. */
+extern const uint8_t fec_genpoly_32[FEC_NROOTS_LONG+1];     /**< Generator polynomial with 32 roots, index form. */
+extern const uint8_t fec_syn_root[FEC_MAX_NROOTS];          /**< Roots of the generator polynomials ((fcr+i)*prim mod nn), index form. */
+
 /**
- * \param rs_ptr
+ * \brief Initializer of a constant control block of the NGHam Reed-Solomon code.
  * 
- * \return None
+ * \param genpoly is the generator polynomial table (fec_genpoly_16 or fec_genpoly_32).
+ * \param nroots is the number of parity symbols (FEC_NROOTS_SHORT or FEC_NROOTS_LONG).
+ * \param len is the length of the shortened codeword (data + parity).
  */
-void free_rs_char(RS *rs_ptr);
+#define FEC_RS_CB(genpoly, nroots, len) {FEC_MM, FEC_NN, fec_alpha_to, fec_index_of, (genpoly), (nroots), FEC_FCR, FEC_PRIM, FEC_IPRIM, FEC_NN-(len)}
 
 /**
- * \param *rs_ptr
- * \param *data
- * \param *parity
+ * \brief Reduces an index modulo nn without loops or branches (valid for 0 <= x < 2*nn).
+ */
+#define FEC_MODNN(x)                    (((x) + (((x) + 1) >> FEC_MM)) & FEC_NN)
+
+/**
+ * \brief Folds a 16-bit product of indexes into the range of fec_alpha_to (2^mm = 1 modulo nn).
+ * 
+ * The result is congruent to x modulo nn and lower than 2*nn (for 0 <= x < nn*256), but not fully reduced.
+ */
+#define FEC_FOLD(x)                     (((x) >> FEC_MM) + ((x) & FEC_NN))
+
+/**
+ * \brief Compile-time assertion (a negative array size breaks the build if cond is false).
+ */
+#define FEC_STATIC_ASSERT(cond, name)   typedef char fec_static_assert_##name[(cond)? 1 : -1]
+
+/**
+ * \brief Computes the Reed-Solomon parity of a data block.
+ * 
+ * \param *rs_ptr is the control block of the code.
+ * \param *data is the data block (nn - nroots - pad bytes).
+ * \param *parity is the array to store the parity symbols (nroots bytes).
  * 
  * \return None
  */
-void encode_rs_char(RS *rs_ptr, uint8_t *data, uint8_t *parity);
+void encode_rs_char(const RS *rs_ptr, uint8_t *data, uint8_t *parity);
 
 /**
  * \param *rs_ptr
@@ -84,17 +128,7 @@ void encode_rs_char(RS *rs_ptr, uint8_t *data, uint8_t *parity);
  * 
  * \return retval
  */
-int16_t decode_rs_char(RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_eras);
-
-/**
- * \brief 
- * 
- * \param *rs
- * \param x
- * 
- * \return 
- */
-int16_t modnn(RS *rs_ptr, int16_t x);
+int16_t decode_rs_char(const RS *rs_ptr, uint8_t *data, int16_t *eras_pos, int16_t no_eras);
 
 #endif // FEC_H_
 
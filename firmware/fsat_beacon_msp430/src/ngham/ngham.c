@@ -36,6 +36,7 @@
  */
 
 #include <stddef.h>                     // For NULL etc.
+#include <stdint.h>                     // For uintptr_t
 
 #include "ngham.h"
 #include "ccsds_scrambler.h"            // Pre-generated array from scrambling polynomial
@@ -45,7 +46,7 @@
 
 #include <stdio.h>
 
-#include <system/system.h>
+#include <system/debug/debug.h>
 
 // There are seven different sizes.
 // Each size has a correlation tag for size, a total size, a maximum payload size and a parity data size.
@@ -71,261 +72,390 @@ const uint8_t NGH_SYNC[]                = {0x5D, 0xE6, 0x2A, 0x7E};
 const uint8_t NGH_PREAMBLE_FOUR_LEVEL   = 0xDD;
 const uint8_t NGH_SYNC_FOUR_LEVEL[]     = {0x77, 0xf7, 0xfd, 0x7d, 0x5d, 0xdd, 0x7f, 0xfd};
 
-// Reed Solomon control blocks for the different NGHAM sizes
-RS rs_cb[NGH_SIZES];
+// Number of set bits of each byte value (for Hamming distances)
+#define NGH_POPCOUNT_2(n)   n, n+1, n+1, n+2
+#define NGH_POPCOUNT_4(n)   NGH_POPCOUNT_2(n), NGH_POPCOUNT_2(n+1), NGH_POPCOUNT_2(n+1), NGH_POPCOUNT_2(n+2)
+#define NGH_POPCOUNT_6(n)   NGH_POPCOUNT_4(n), NGH_POPCOUNT_4(n+1), NGH_POPCOUNT_4(n+1), NGH_POPCOUNT_4(n+2)
+const uint8_t ngham_popcount[256] = {NGH_POPCOUNT_6(0), NGH_POPCOUNT_6(1), NGH_POPCOUNT_6(1), NGH_POPCOUNT_6(2)};
+
+// Reed Solomon control blocks for the different NGHAM sizes (constants, sharing the 16 and 32 roots tables)
+// The codeword lengths are the NGH_PL_PAR_SIZE values
+const RS rs_cb[NGH_SIZES] = {
+    FEC_RS_CB(fec_genpoly_16, FEC_NROOTS_SHORT, 47),
+    FEC_RS_CB(fec_genpoly_16, FEC_NROOTS_SHORT, 79),
+    FEC_RS_CB(fec_genpoly_16, FEC_NROOTS_SHORT, 111),
+    FEC_RS_CB(fec_genpoly_32, FEC_NROOTS_LONG, 159),
+    FEC_RS_CB(fec_genpoly_32, FEC_NROOTS_LONG, 191),
+    FEC_RS_CB(fec_genpoly_32, FEC_NROOTS_LONG, 223),
+    FEC_RS_CB(fec_genpoly_32, FEC_NROOTS_LONG, 255)
+};
+
+// Decoder context of the single-decoder API (ngham_decode)
+static NGHamDecoder ngham_default_decoder;
+
+FEC_STATIC_ASSERT(sizeof(NGHamDecoder) <= NGHAM_RAM_MAX, ngham_ram_footprint);
 
 void ngham_init()
 {
     debug_print_event_from_module(DEBUG_INFO, NGHAM_MODULE_NAME, "Initializing...\n\r");
 
-    decoder_state = NGH_STATE_SIZE_TAG;
-    
-    ngham_init_arrays();
+    ngham_decoder_init(&ngham_default_decoder);
 }
 
-void ngham_init_arrays()
+/**
+ * \brief Finds the size tag closest to a received one.
+ * 
+ * The Hamming distance to each tag is counted one byte at a time with a popcount table.
+ * The minimum distance between two tags is 13 bits, so any tag within NGH_SIZE_TAG_MAX_ERROR bits is the only candidate.
+ * 
+ * NGHam library internal function.
+ * 
+ * \param tag is the received size tag (24 bits).
+ * \param distance is the Hamming distance between tag and the closest size tag.
+ * 
+ * \return The size number of the closest size tag.
+ */
+static uint8_t ngham_tag_closest(uint32_t tag, uint8_t *distance)
 {
-    debug_print_event_from_module(DEBUG_INFO, NGHAM_MODULE_NAME, "Initializing arrays...\n\r");
+    uint8_t i, best, dist;
+    uint32_t diff;
 
-    uint8_t i;
-    for(i=0;i<NGH_SIZES;i++)
+    best = 0;
+    *distance = 0xFF;
+    for(i=0; i<NGH_SIZES; i++)
     {
-        rs_cb[i].mm         = 0;
-        rs_cb[i].nn         = 0;
-        rs_cb[i].alpha_to   = (uint8_t*)0;
-        rs_cb[i].index_of   = (uint8_t*)0;
-        rs_cb[i].genpoly    = (uint8_t*)0;
-        rs_cb[i].nroots     = 0;
-        rs_cb[i].fcr        = 0;
-        rs_cb[i].prim       = 0;
-        rs_cb[i].iprim      = 0;
-        rs_cb[i].pad        = NGH_PL_PAR_SIZE[6] - NGH_PL_PAR_SIZE[i];
+        diff = tag ^ NGH_SIZE_TAG[i];
+        dist = ngham_popcount[diff & 0xFF] + ngham_popcount[(diff >> 8) & 0xFF] + ngham_popcount[(diff >> 16) & 0xFF];
+        if (dist < *distance)
+        {
+            best = i;
+            *distance = dist;
+        }
     }
+
+    return best;
 }
 
-void ngham_deinit_arrays()
+uint8_t ngham_decode(uint8_t d, uint8_t *msg, uint8_t *msg_len)
 {
-    debug_print_event_from_module(DEBUG_INFO, NGHAM_MODULE_NAME, "Deinitializing arrays...\n\r");
+    return ngham_decoder_push(&ngham_default_decoder, d, msg, msg_len);
+}
 
-    free_rs_char(&rs_cb[0]);    // Free memory for nroots = 16
-    free_rs_char(&rs_cb[3]);    // Free memory for nroots = 32
+void ngham_mark_erasure()
+{
+    ngham_decoder_mark_erasure(&ngham_default_decoder);
+}
+
+void ngham_decoder_init(NGHamDecoder *dec)
+{
+    dec->state      = NGH_STATE_SIZE_TAG;
+    dec->size_nr    = 0;
+    dec->size_tag   = 0;
+    dec->length     = 0;
+    dec->no_eras    = 0;
+    dec->eras_next  = 0;
+
+    ngham_rx_pkt_init(&dec->rx_pkt);
 }
 
+void ngham_decoder_mark_erasure(NGHamDecoder *dec)
+{
+    dec->eras_next = 1;
+}
+
+#if defined(__GNUC__)
+/**
+ * \brief 16-bit word that may alias the bytes of the codeword arrays (GCC type attribute).
+ */
+typedef uint16_t __attribute__ ((may_alias)) ngham_word_t;
+#endif // __GNUC__
+
 /**
- * \brief Check hamming distance.
+ * \brief Descrambles a block of codeword bytes.
  * 
- * Used to check if hamming distance in size tag is smaller than treshold.
+ * With GCC, works on 16-bit words when the three arrays have the same alignment. The other compilers go byte by byte.
  * 
  * NGHam library internal function.
  * 
- * \param x
- * \param y
+ * \param dst is the destination array.
+ * \param src is the scrambled data.
+ * \param pos is the position of the first byte in the codeword.
+ * \param len is the number of bytes to descramble.
  * 
- * \return It can return:
- *          - NGH_HAMMING_DISTANCE_GREATER if false
- *          - NGH_HAMMING_DISTANCE_SMALLER if true
- *          .
+ * \return None
  */
-static uint8_t ngham_tag_check(uint32_t x, uint32_t y)
+static void ngham_descramble(uint8_t *dst, const uint8_t *src, uint16_t pos, uint16_t len)
 {
-    uint8_t j, distance;
-    uint32_t diff;
-    diff = x^y;
-    if (!diff)
-    {
-        return NGH_HAMMING_DISTANCE_SMALLER;	// Early check to save time
-    }
+    const uint8_t *poly = &ccsds_poly[pos];
 
-    distance = 0;
-    for(j=0; j<24; j++)
+#if defined(__GNUC__)
+    if (((((uintptr_t)dst ^ (uintptr_t)src) | ((uintptr_t)dst ^ (uintptr_t)poly)) & 0x01) == 0)
     {
-        if (diff & 0x01)
+        if (((uintptr_t)dst & 0x01) && (len > 0))
         {
-            distance++;
-            if (distance > NGH_SIZE_TAG_MAX_ERROR)
-            {
-                return NGH_HAMMING_DISTANCE_GREATER;
-            }
+            *dst++ = *src++ ^ *poly++;
+            len--;
+        }
+
+        for(; len>=2; len-=2)
+        {
+            *(ngham_word_t*)dst = *(const ngham_word_t*)src ^ *(const ngham_word_t*)poly;
+            dst += 2;
+            src += 2;
+            poly += 2;
         }
-        diff >>= 0x01;
     }
-    
-    return NGH_HAMMING_DISTANCE_SMALLER;
+#endif // __GNUC__
+
+    while(len--)
+    {
+        *dst++ = *src++ ^ *poly++;
+    }
 }
 
-void ngham_encode(NGHam_TX_Packet *p, uint8_t *pkt, uint16_t *pkt_len)
+bool ngham_encode_frame(PacketBuilder *pb, uint8_t ngham_flags)
 {
+    uint8_t *codeword;
+    uint8_t *trailer;
+    uint8_t *tag;
+    uint16_t pl_len = packet_builder_len(pb);
+    uint16_t trailer_len;
+    uint16_t crc;
     uint16_t j;
+    uint8_t size_nr = 0;
+
+    debug_print_event_from_module(DEBUG_INFO, NGHAM_MODULE_NAME, "Encoding a new packet (");
+    debug_print_dec(pl_len);
+    debug_print_msg(" bytes)...\n\r");
 
-    debug_print_event_from_module(DEBUG_INFO, NGHAM_MODULE_NAME, "Encoding a new packet: ");
-    for(j=0; j<p->pl_len; j++)
+    // Check size and find control block for smallest possible RS codeword
+    if ((pl_len == 0) || (pl_len > NGH_PL_SIZE[NGH_SIZES-1]))
     {
-        debug_print_hex(p->pl[j]);
+        return false;
+    }
+    while(pl_len > NGH_PL_SIZE[size_nr])
+    {
+        size_nr++;
+    }
 
-        if (j < p->pl_len-1)
-        {
-            debug_print_msg(", ");
-        }
+    // CRC, padding and parity data after the payload
+    trailer_len = NGH_PL_PAR_SIZE[size_nr] - 1 - pl_len;
+    if ((pb->head < NGH_FRAME_HEADROOM) || (packet_builder_tailroom(pb) < trailer_len))
+    {
+        return false;
     }
-    debug_print_msg("\n\r");
 
-    uint16_t crc;
-    uint8_t size_nr = 0;
-    uint8_t d[NGH_MAX_TOT_SIZE];
-    uint16_t d_len = 0;
-    uint8_t codeword_start;
+    // Padding size and flags before the payload
+    codeword = packet_builder_push(pb, 1);
+    codeword[0] = ((NGH_PL_SIZE[size_nr] - pl_len) & NGH_PADDING_bm) | ((ngham_flags << NGH_FLAGS_bp) & NGH_FLAGS_bm);
 
-    // Check size and find control block for smallest possible RS codeword
-    if ((p->pl_len == 0) || (p->pl_len > NGH_PL_SIZE[NGH_SIZES-1]))
+    trailer = packet_builder_put(pb, trailer_len);
+    crc = ngham_CRC_CCITT(codeword, pl_len+1);
+    trailer[0] = (crc >> 8) & 0xFF;
+    trailer[1] = crc & 0xFF;
+    for(j=2; j<NGH_PL_SIZE_FULL[size_nr]-1-pl_len; j++)
     {
-        return;
+        trailer[j] = 0;     // Insert padding
     }
-    while(p->pl_len > NGH_PL_SIZE[size_nr])
+
+    // Generate parity data
+    encode_rs_char(&rs_cb[size_nr], codeword, &codeword[NGH_PL_SIZE_FULL[size_nr]]);
+
+    // Scramble (the same operation as descrambling)
+    ngham_descramble(codeword, codeword, 0, NGH_PL_PAR_SIZE[size_nr]);
+
+    tag = packet_builder_push(pb, NGH_SIZE_TAG_SIZE);
+    tag[0] = (NGH_SIZE_TAG[size_nr] >> 16) & 0xFF;
+    tag[1] = (NGH_SIZE_TAG[size_nr] >> 8) & 0xFF;
+    tag[2] = NGH_SIZE_TAG[size_nr] & 0xFF;
+
+    return true;
+}
+
+void ngham_encode(NGHam_TX_Packet *p, uint8_t *pkt, uint16_t *pkt_len)
+{
+    PacketBuilder pb;
+    uint8_t *sync;
+    uint16_t j;
+
+    *pkt_len = 0;
+
+    // The header fills the headroom exactly, so the frame starts at pkt[0]
+    packet_builder_init(&pb, pkt, NGH_MAX_TOT_SIZE, NGH_SYNC_HEADROOM + NGH_FRAME_HEADROOM);
+
+    if (!packet_builder_append(&pb, p->pl, p->pl_len) || !ngham_encode_frame(&pb, p->ngham_flags))
     {
-        size_nr++;
+        return;
     }
 
-    // Insert preamble, sync and size-tag
+    // Insert preamble and sync
+    sync = packet_builder_push(&pb, NGH_SYNC_HEADROOM);
     if (NGHAM_FOUR_LEVEL_MODULATION)
     {
-        codeword_start = NGH_PREAMBLE_SIZE_FOUR_LEVEL + NGH_SYNC_SIZE_FOUR_LEVEL + NGH_SIZE_TAG_SIZE;
         for(j=0; j<NGH_PREAMBLE_SIZE_FOUR_LEVEL; j++)
         {
-            d[d_len++] = NGH_PREAMBLE_FOUR_LEVEL;
+            *sync++ = NGH_PREAMBLE_FOUR_LEVEL;
         }
         for(j=0; j<NGH_SYNC_SIZE_FOUR_LEVEL; j++)
         {
-            d[d_len++] = NGH_SYNC_FOUR_LEVEL[j];
+            *sync++ = NGH_SYNC_FOUR_LEVEL[j];
         }
     }
     else
     {
-        codeword_start = NGH_PREAMBLE_SIZE + NGH_SYNC_SIZE + NGH_SIZE_TAG_SIZE;
         for(j=0; j<NGH_PREAMBLE_SIZE; j++)
         {
-            d[d_len++] = NGH_PREAMBLE;
+            *sync++ = NGH_PREAMBLE;
         }
         for(j=0; j<NGH_SYNC_SIZE; j++)
         {
-            d[d_len++] = NGH_SYNC[j];
+            *sync++ = NGH_SYNC[j];
         }
     }
-    d[d_len++] = (NGH_SIZE_TAG[size_nr] >> 16) & 0xFF;
-    d[d_len++] = (NGH_SIZE_TAG[size_nr] >> 8) & 0xFF;
-    d[d_len++] = NGH_SIZE_TAG[size_nr] & 0xFF;
-
-    // Prepare content of codeword
-    d[d_len] = (NGH_PL_SIZE[size_nr] - p->pl_len) & 0x1F;	// Insert padding size
-    d[d_len] |= (p->ngham_flags << 5) & 0xE0;				// Insert flags
-    d_len++;
-    for(j=0; j<p->pl_len; j++)
-    {
-        d[d_len++] = p->pl[j];		// Insert data
-    }
-    crc = ngham_CRC_CCITT(&d[codeword_start], p->pl_len+1);	// Insert CRC
-    d[d_len++] = (crc >> 8) & 0xFF;
-    d[d_len++] = crc & 0xFF;
-    for(j=p->pl_len+3; j<NGH_PL_SIZE_FULL[size_nr]; j++)
-    {
-        d[d_len++] = 0;	// Insert padding
-    }
 
-    // Generate parity data
-    encode_rs_char(&rs_cb[size_nr], &d[codeword_start], &d[d_len]);
-    d_len += NGH_PAR_SIZE[size_nr];
+    *pkt_len = packet_builder_len(&pb);
+}
+
+uint8_t ngham_decode_block(NGHamDecoder *dec, const uint8_t *data, uint16_t len, uint16_t *consumed, uint8_t *msg, uint8_t *msg_len)
+{
+    // This points to the address one lower than the payload!
+    uint8_t *buf = (uint8_t*)&dec->rx_pkt.ngham_flags;
+    uint8_t state = PKT_CONDITION_PREFAIL;
+    uint16_t i = 0;
 
-    // Scramble
-    for(j=0; j<NGH_PL_PAR_SIZE[size_nr]; j++)
+    while(i < len)
     {
-        d[codeword_start+j] ^= ccsds_poly[j];
+        // Bulk copy of the codeword, except for its last byte (which triggers the decoding) and erasures
+        if ((dec->state == NGH_STATE_SIZE_KNOWN) && !dec->eras_next)
+        {
+            uint16_t n = NGH_PL_PAR_SIZE[dec->size_nr] - 1 - dec->length;
+
+            if (n > len - i)
+            {
+                n = len - i;
+            }
+
+            if (n > 0)
+            {
+                ngham_descramble(&buf[dec->length], &data[i], dec->length, n);
+
+                if ((dec->length < NGHAM_BYTES_TILL_ACTION_HALFWAY) && (dec->length + n >= NGHAM_BYTES_TILL_ACTION_HALFWAY))
+                {
+                    ngham_action_reception_halfway();
+                }
+
+                dec->length += n;
+                i += n;
+
+                continue;
+            }
+        }
+
+        state = ngham_decoder_push(dec, data[i++], msg, msg_len);
+        if (state != PKT_CONDITION_PREFAIL)
+        {
+            break;
+        }
     }
 
-    ngham_action_send_data(d, d_len, p->priority, pkt, pkt_len);
+    *consumed = i;
+
+    return state;
 }
 
-uint8_t ngham_decode(uint8_t d, uint8_t *msg, uint8_t *msg_len)
+uint8_t ngham_decoder_push(NGHamDecoder *dec, uint8_t d, uint8_t *msg, uint8_t *msg_len)
 {
-    static uint8_t size_nr;
-    static uint32_t size_tag;
-    static uint16_t length;
     // This points to the address one lower than the payload!
-    static uint8_t *buf = (uint8_t*)&rx_pkt.ngham_flags;
+    uint8_t *buf = (uint8_t*)&dec->rx_pkt.ngham_flags;
+    uint8_t erased = dec->eras_next;
 
-    switch(decoder_state)
+    dec->eras_next = 0;
+
+    switch(dec->state)
     {
         case NGH_STATE_SIZE_TAG:
-            size_tag = 0;
+            dec->size_tag = 0;
+            dec->no_eras = 0;
             ngham_action_reception_started();
             
         case NGH_STATE_SIZE_TAG_2:
-            size_tag <<= 8;
-            size_tag |= d;
-            decoder_state++;
+            dec->size_tag <<= 8;
+            dec->size_tag |= d;
+            dec->state++;
             break;
 
         case NGH_STATE_SIZE_TAG_3:
-            size_tag <<= 8;
-            size_tag |= d;
+            dec->size_tag <<= 8;
+            dec->size_tag |= d;
             {
-                for(size_nr=0; size_nr<NGH_SIZES; size_nr++)
+                uint8_t distance;
+
+                dec->size_nr = ngham_tag_closest(dec->size_tag, &distance);
+
+                // If tag is intact, set known size
+                if (distance <= NGH_SIZE_TAG_MAX_ERROR)
                 {
-                    // If tag is intact, set known size
-                    if (ngham_tag_check(size_tag, NGH_SIZE_TAG[size_nr]))
-                    {
-                        decoder_state = NGH_STATE_SIZE_KNOWN;
-                        length = 0;
+                    dec->state = NGH_STATE_SIZE_KNOWN;
+                    dec->length = 0;
 
-                        // Set new packet size as soon as possible
-                        ngham_action_set_packet_size(NGH_PL_PAR_SIZE[size_nr] + NGH_SIZE_TAG_SIZE);
-                        break;
-                    }
+                    // Set new packet size as soon as possible
+                    ngham_action_set_packet_size(NGH_PL_PAR_SIZE[dec->size_nr] + NGH_SIZE_TAG_SIZE);
                 }
                 // If size tag is not found, every size can theoretically be attempted
-                if (decoder_state != NGH_STATE_SIZE_KNOWN)
+                else
                 {
                     ngham_action_handle_packet(PKT_CONDITION_PREFAIL, NULL, NULL, NULL);
-                    decoder_state = NGH_STATE_SIZE_TAG;
+                    ngham_rx_pkt_init(&dec->rx_pkt);
+                    dec->state = NGH_STATE_SIZE_TAG;
                 }
             }
             break;
 
         case NGH_STATE_SIZE_KNOWN:
+            // Erasure positions are relative to the full (not shortened) codeword
+            if (erased && (dec->no_eras < NGH_PAR_SIZE[dec->size_nr]))
+            {
+                dec->eras_pos[dec->no_eras++] = rs_cb[dec->size_nr].pad + dec->length;
+            }
+
             // De-scramble byte and append to buffer
-            buf[length] = d^ccsds_poly[length];
-            length++;
+            buf[dec->length] = d^ccsds_poly[dec->length];
+            dec->length++;
 
             // Do whatever is necessary in this action
-            if (length == NGHAM_BYTES_TILL_ACTION_HALFWAY)
+            if (dec->length == NGHAM_BYTES_TILL_ACTION_HALFWAY)
             {
                 ngham_action_reception_halfway();
             }
 
-            if (length == NGH_PL_PAR_SIZE[size_nr])
+            if (dec->length == NGH_PL_PAR_SIZE[dec->size_nr])
             {
                 int8_t errors;
+                NGHam_RX_Packet *rx_pkt = &dec->rx_pkt;
 
                 // Set packet size back to a large value
                 ngham_action_set_packet_size(255);
-                decoder_state = NGH_STATE_SIZE_TAG;
+                dec->state = NGH_STATE_SIZE_TAG;
 
                 // Run Reed Solomon decoding, calculate packet length
-                errors = decode_rs_char(&rs_cb[size_nr], buf, 0, 0);
-                rx_pkt.pl_len = NGH_PL_SIZE[size_nr] - (buf[0] & NGH_PADDING_bm);
+                errors = decode_rs_char(&rs_cb[dec->size_nr], buf, dec->eras_pos, dec->no_eras);
+                rx_pkt->pl_len = NGH_PL_SIZE[dec->size_nr] - (buf[0] & NGH_PADDING_bm);
 
                 // Check if the packet is decodeable and then if CRC is OK
-                if ((errors != -1) && (ngham_CRC_CCITT(buf, rx_pkt.pl_len + 1) == ((buf[rx_pkt.pl_len + 1] << 8) | buf[rx_pkt.pl_len + 2])) )
+                if ((errors != -1) && (ngham_CRC_CCITT(buf, rx_pkt->pl_len + 1) == ((buf[rx_pkt->pl_len + 1] << 8) | buf[rx_pkt->pl_len + 2])) )
                 {
 
                     // Copy remaining fields and pass on
-                    rx_pkt.errors = errors;
-                    rx_pkt.ngham_flags = (buf[0] & NGH_FLAGS_bm) >> NGH_FLAGS_bp;
-                    rx_pkt.noise = ngham_action_get_noise_floor();
-                    rx_pkt.rssi = ngham_action_get_rssi();
-                    ngham_action_handle_packet(PKT_CONDITION_OK, &rx_pkt, msg, msg_len);
+                    rx_pkt->errors = errors;
+                    rx_pkt->ngham_flags = (buf[0] & NGH_FLAGS_bm) >> NGH_FLAGS_bp;
+                    rx_pkt->noise = ngham_action_get_noise_floor();
+                    rx_pkt->rssi = ngham_action_get_rssi();
+                    ngham_action_handle_packet(PKT_CONDITION_OK, rx_pkt, msg, msg_len);
+                    ngham_rx_pkt_init(rx_pkt);
 
                     debug_print_event_from_module(DEBUG_INFO, NGHAM_MODULE_NAME, "Decoded packat: ");
                     uint16_t i;
-                    for(i; i<*msg_len; i++)
+                    for(i=0; i<*msg_len; i++)
                     {
                         debug_print_hex(msg[i]);
 
@@ -344,6 +474,7 @@ uint8_t ngham_decode(uint8_t d, uint8_t *msg, uint8_t *msg_len)
                     debug_print_event_from_module(DEBUG_ERROR, NGHAM_MODULE_NAME, "Error during packet decoding! Maybe the packet is corrupted!\n\r");
 
                     ngham_action_handle_packet(PKT_CONDITION_FAIL, NULL, NULL, NULL);
+                    ngham_rx_pkt_init(rx_pkt);
                     return PKT_CONDITION_FAIL;
                 }
             }
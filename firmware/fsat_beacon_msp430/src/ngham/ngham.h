@@ -40,6 +40,9 @@
 #define NGHAM_H_
 
 #include <stdint.h>
+#include <stdbool.h>
+
+#include <system/packet_builder/packet_builder.h>
 
 #include "fec.h"
 #include "ngham_packets.h"
@@ -54,6 +57,21 @@
 
 #define NGHAM_FOUR_LEVEL_MODULATION     0
 
+/**
+ * \brief Headroom of a payload for ngham_encode_frame (size tag, padding size and flags).
+ */
+#define NGH_FRAME_HEADROOM              (NGH_SIZE_TAG_SIZE + 1)
+
+/**
+ * \brief Preamble and sync. word length of the selected modulation.
+ */
+#define NGH_SYNC_HEADROOM               (NGHAM_FOUR_LEVEL_MODULATION? (NGH_PREAMBLE_SIZE_FOUR_LEVEL+NGH_SYNC_SIZE_FOUR_LEVEL) : (NGH_PREAMBLE_SIZE+NGH_SYNC_SIZE))
+
+/**
+ * \brief Maximum length of a frame from ngham_encode_frame (size tag and codeword).
+ */
+#define NGH_MAX_FRAME_SIZE              (NGH_SIZE_TAG_SIZE + NGH_MAX_CODEWORD_SIZE)
+
 #define NGH_PADDING_bm                  0x1F
 #define NGH_FLAGS_bm                    0xE0
 #define NGH_FLAGS_bp                    5
@@ -81,8 +99,22 @@
  */
 #define NGH_SIZE_TAG_MAX_ERROR          6
 
-#define NGH_HAMMING_DISTANCE_GREATER    0x00
-#define NGH_HAMMING_DISTANCE_SMALLER    0x01
+/**
+ * \brief Decoder context.
+ * 
+ * Holds the whole reception state, so independent decoders (one per radio, one per candidate sync offset, etc.) can run side by side.
+ */
+typedef struct
+{
+    uint8_t state;                          /**< Decoder state (NGH_STATE_*). */
+    uint8_t size_nr;                        /**< Size number of the packet being received. */
+    uint32_t size_tag;                      /**< Received size tag. */
+    uint16_t length;                        /**< Received codeword bytes. */
+    int16_t eras_pos[FEC_MAX_NROOTS];       /**< Erasure positions, relative to the full (not shortened) codeword. */
+    uint8_t no_eras;                        /**< Number of erasures in eras_pos. */
+    uint8_t eras_next;                      /**< The next pushed byte is an erasure. */
+    NGHam_RX_Packet rx_pkt;                 /**< Packet being received (the codeword is stored from rx_pkt.ngham_flags on). */
+} NGHamDecoder;
 
 #define NGHAM_MODULE_NAME               "NGHam"
 
@@ -100,7 +132,9 @@ extern const uint8_t NGH_SYNC[];                /**< . */
 extern const uint8_t NGH_PREAMBLE_FOUR_LEVEL;   /**< . */
 extern const uint8_t NGH_SYNC_FOUR_LEVEL[];     /**< . */
 
-extern RS rs_cb[NGH_SIZES];                     /**< Reed Solomon control blocks for the different NGHAM sizes. */
+extern const uint8_t ngham_popcount[256];       /**< Number of set bits of each byte value. */
+
+extern const RS rs_cb[NGH_SIZES];               /**< Reed Solomon control blocks for the different NGHAM sizes. */
 
 /**
  * \brief NGHam initialization.
@@ -110,37 +144,37 @@ extern RS rs_cb[NGH_SIZES];                     /**< Reed Solomon control blocks
 void ngham_init();
 
 /**
- * \brief Generates Reed Solomon tables.
+ * \brief Packet encoding.
  * 
- * Run only once - generates reed solomon tables for all 7 packet sizes
- * MM=8, genpoly=0x187, fcs=112, prim=11, nroots=32 or 16
+ * Packets to be transmitted are passed to this function - max. length 220 B
  * 
- * \return None
- */
-void ngham_init_arrays();
-
-/**
- * \brief Free Reed Solomon tables.
+ * The payload is copied once into pkt and encoded there by ngham_encode_frame, with the preamble and sync. word.
+ * The packet priority is not used: the caller transmits pkt, and handles any timing.
+ * 
+ * \param *p is the packet to encode.
+ * \param *pkt is the array to store the encoded packet (up to NGH_MAX_TOT_SIZE bytes).
+ * \param *pkt_len is the length of the encoded packet (0 if the payload is empty or too long).
  * 
  * \return None
  */
-void ngham_deinit_arrays();
+void ngham_encode(NGHam_TX_Packet *p, uint8_t *pkt, uint16_t *pkt_len);
 
 /**
- * \brief Packet encoding.
+ * \brief Encodes the payload of a packet builder in place.
  * 
- * Packets to be transmitted are passed to this function - max. length 220 B
+ * The frame becomes the size tag and the scrambled codeword (without preamble and sync. word, as written to the
+ * radio FIFO). The padding size, flags and size tag go into the headroom (at least NGH_FRAME_HEADROOM bytes), and the
+ * CRC, padding and RS parity after the payload (up to NGH_MAX_FRAME_SIZE bytes in total).
  * 
- * \param *p
- * \param *pkt
- * \param *pkt_len
+ * \param *pb is the packet builder, with the payload (1 to NGHAM_PL_MAX bytes).
+ * \param ngham_flags is the flags field of the codeword (3 bits).
  * 
- * \return None
+ * \return TRUE if the frame was encoded, FALSE if the payload or the room around it have an invalid size (the frame is not changed).
  */
-void ngham_encode(NGHam_TX_Packet *p, uint8_t *pkt, uint16_t *pkt_len);
+bool ngham_encode_frame(PacketBuilder *pb, uint8_t ngham_flags);
 
 /**
- * \brief Packet decoding.
+ * \brief Packet decoding with the default decoder context (initialized by ngham_init).
  * 
  * Packet to be decoded (Without preamble and sync. bytes).
  * 
@@ -152,6 +186,64 @@ void ngham_encode(NGHam_TX_Packet *p, uint8_t *pkt, uint16_t *pkt_len);
  */
 uint8_t ngham_decode(uint8_t d, uint8_t *msg, uint8_t *msg_len);
 
+/**
+ * \brief Flags the next byte passed to ngham_decode() as an erasure.
+ * 
+ * Should be called by the radio layer for bytes received with low confidence (RSSI dips, FIFO overruns, etc.).
+ * The Reed Solomon decoder corrects up to nroots erasures, against nroots/2 errors at unknown positions.
+ * 
+ * \return None
+ */
+void ngham_mark_erasure();
+
+/**
+ * \brief Decoder context initialization.
+ * 
+ * \param *dec is the decoder context.
+ * 
+ * \return None
+ */
+void ngham_decoder_init(NGHamDecoder *dec);
+
+/**
+ * \brief Pushes a received byte (after the sync. word) into a decoder context.
+ * 
+ * \param *dec is the decoder context.
+ * \param d is the received byte.
+ * \param *msg is the array to store the decoded payload.
+ * \param *msg_len is the length of the decoded payload.
+ * 
+ * \return The decodification state (PKT_CONDITION_PREFAIL while the packet is incomplete).
+ */
+uint8_t ngham_decoder_push(NGHamDecoder *dec, uint8_t d, uint8_t *msg, uint8_t *msg_len);
+
+/**
+ * \brief Pushes a block of received bytes (ex.: a whole radio FIFO read) into a decoder context.
+ * 
+ * The size tag and the last byte of the codeword go through ngham_decoder_push.
+ * The rest of the codeword is descrambled and copied to the RS buffer in bulk.
+ * Decoding stops at the end of a packet, so the remaining bytes can be pushed again (after a new sync. word).
+ * 
+ * \param *dec is the decoder context.
+ * \param *data is the received bytes (after the sync. word).
+ * \param len is the number of bytes in data.
+ * \param *consumed is the number of bytes of data used by the decoder.
+ * \param *msg is the array to store the decoded payload.
+ * \param *msg_len is the length of the decoded payload.
+ * 
+ * \return The decodification state (PKT_CONDITION_PREFAIL if no packet was finished).
+ */
+uint8_t ngham_decode_block(NGHamDecoder *dec, const uint8_t *data, uint16_t len, uint16_t *consumed, uint8_t *msg, uint8_t *msg_len);
+
+/**
+ * \brief Flags the next byte pushed into a decoder context as an erasure.
+ * 
+ * \param *dec is the decoder context.
+ * 
+ * \return None
+ */
+void ngham_decoder_mark_erasure(NGHamDecoder *dec);
+
 #endif // NGHAM_H_
 
 //! \} End of NGHam group
@@ -89,7 +89,7 @@ typedef struct ATTRIBUTE_PACKED
  */
 typedef struct ATTRIBUTE_PACKED
 {
-    uint8_t priority;
+    uint8_t priority;               /**< Transmission priority (not used by ngham_encode). */
     uint8_t ngham_flags;
     uint8_t pl[PKT_PL_SIZE];
     uint16_t pl_len;
@@ -0,0 +1,299 @@
+/*
+ * ngham_sync.c
+ *
+ * Copyright (C) 2017, Gabriel Mariano Marcelino
+ *
+ * This file is part of FloripaSat-TTC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ */
+
+/**
+ * \brief Bit-level sync. word search implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \addtogroup ngham_sync
+ * \{
+ */
+
+#include "ngham_sync.h"
+#include "ngham_packets.h"
+
+/**
+ * \brief Counts the set bits of a 64-bit word.
+ *
+ * \param x is the word.
+ *
+ * \return The number of set bits.
+ */
+static uint8_t ngham_sync_popcount(uint64_t x)
+{
+#if defined(__GNUC__) && !defined(__MSP430__)
+    return __builtin_popcountll(x);
+#else
+    uint8_t n = 0;
+
+    while(x)
+    {
+        n += ngham_popcount[x & 0xFF];
+        x >>= 8;
+    }
+
+    return n;
+#endif // __GNUC__
+}
+
+/**
+ * \brief Searches the sync. word in the bit windows ending inside the last received byte.
+ *
+ * \param *sync is the sync. search context.
+ * \param max_k is the largest number of bits after the sync. word to try (7 for the whole byte).
+ *
+ * \return The number of bits of the last byte after the sync. word (0 to max_k), or -1 if the sync. word was not found.
+ */
+static int8_t ngham_sync_search(NGHamSync *sync, int8_t max_k)
+{
+    int8_t k;
+
+    // The earliest sync. word (the largest number of bits after it) first
+    for(k=max_k; k>=0; k--)
+    {
+        uint64_t window = sync->reg;
+
+        if (sync->reg_bits < sync->sync_bits + k)
+        {
+            continue;
+        }
+
+        if (k > 0)
+        {
+            window = (sync->reg >> k) | ((uint64_t)sync->reg_top << (64 - k));
+        }
+
+        if (ngham_sync_popcount((window ^ sync->sync_word) & sync->sync_mask) <= sync->max_errors)
+        {
+            return k;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * \brief Starts a packet after a sync. word.
+ *
+ * \param *sync is the sync. search context.
+ * \param k is the number of bits of the last byte after the sync. word.
+ * \param byte is the last byte.
+ *
+ * \return None
+ */
+static void ngham_sync_lock(NGHamSync *sync, int8_t k, uint8_t byte)
+{
+    // The last k bits of this byte are the first bits of the packet
+    sync->locked = 1;
+    sync->shift = k;
+    sync->carry = byte & ((1 << k) - 1);
+    sync->tag_raw_len = 0;
+
+    ngham_decoder_init(sync->dec);
+}
+
+/**
+ * \brief Goes back to the search after a rejected size tag.
+ *
+ * The search register still ends at the byte of the false sync. word, so the search goes on from the bits after it:
+ * first the rest of that byte, then the size tag bytes, again.
+ *
+ * \param *sync is the sync. search context.
+ *
+ * \return None
+ */
+static void ngham_sync_reject(NGHamSync *sync)
+{
+    uint8_t buf[NGH_SIZE_TAG_SIZE];
+    uint8_t n = 0;
+    uint8_t j;
+    int8_t k = -1;
+
+    // At most NGH_SIZE_TAG_SIZE bytes: the tag bytes, then the ones of a previous rejection not searched yet
+    for(j=0; j<sync->tag_raw_len; j++)
+    {
+        buf[n++] = sync->tag_raw[j];
+    }
+
+    for(j=sync->replay_pos; j<sync->replay_len; j++)
+    {
+        buf[n++] = sync->replay[j];
+    }
+
+    for(j=0; j<n; j++)
+    {
+        sync->replay[j] = buf[j];
+    }
+
+    sync->replay_len = n;
+    sync->replay_pos = 0;
+    sync->tag_raw_len = 0;
+    sync->locked = 0;
+
+    if (sync->shift > 0)
+    {
+        k = ngham_sync_search(sync, sync->shift - 1);
+    }
+
+    if (k >= 0)
+    {
+        ngham_sync_lock(sync, k, (uint8_t)sync->reg);
+    }
+}
+
+void ngham_sync_init(NGHamSync *sync, NGHamDecoder *dec, uint8_t four_level, uint8_t max_errors)
+{
+    uint8_t i;
+
+    sync->dec           = dec;
+    sync->sync_word     = 0;
+    sync->sync_bits     = four_level? NGH_SYNC_SIZE_FOUR_LEVEL*8 : NGH_SYNC_SIZE*8;
+    sync->sync_mask     = (sync->sync_bits == 64)? 0xFFFFFFFFFFFFFFFFULL : ((1ULL << sync->sync_bits) - 1);
+    sync->max_errors    = max_errors;
+    sync->reg           = 0;
+    sync->reg_top       = 0;
+    sync->reg_bits      = 0;
+    sync->locked        = 0;
+    sync->shift         = 0;
+    sync->carry         = 0;
+    sync->tag_raw_len   = 0;
+    sync->replay_len    = 0;
+    sync->replay_pos    = 0;
+
+    for(i=0; i<sync->sync_bits/8; i++)
+    {
+        sync->sync_word <<= 8;
+        sync->sync_word |= four_level? NGH_SYNC_FOUR_LEVEL[i] : NGH_SYNC[i];
+    }
+
+    ngham_decoder_init(dec);
+}
+
+uint8_t ngham_sync_push(NGHamSync *sync, const uint8_t *data, uint16_t len, uint16_t *consumed, uint8_t *msg, uint8_t *msg_len)
+{
+    uint8_t state = PKT_CONDITION_PREFAIL;
+    uint16_t i = 0;
+
+    // The bytes of a rejected size tag go first
+    while((i < len) || (sync->replay_pos < sync->replay_len))
+    {
+        uint8_t replaying = sync->replay_pos < sync->replay_len;
+
+        if (!sync->locked)
+        {
+            uint8_t byte = replaying? sync->replay[sync->replay_pos++] : data[i++];
+            int8_t k;
+
+            sync->reg_top = (uint8_t)(sync->reg >> 56);
+            sync->reg = (sync->reg << 8) | byte;
+            if (sync->reg_bits < 72)
+            {
+                sync->reg_bits += 8;
+            }
+
+            k = ngham_sync_search(sync, 7);
+            if (k >= 0)
+            {
+                ngham_sync_lock(sync, k, byte);
+            }
+        }
+        else
+        {
+            uint8_t block[NGH_SYNC_BLOCK_SIZE];
+            const uint8_t *raw = replaying? &sync->replay[sync->replay_pos] : &data[i];
+            const uint8_t *src = raw;
+            uint16_t n = 1;     // The size tag goes byte by byte, to stop as soon as it is rejected
+            uint16_t j = 0;
+            uint16_t used = 0;
+
+            // The rest of the codeword, at most
+            if (!replaying && (sync->dec->state == NGH_STATE_SIZE_KNOWN))
+            {
+                n = NGH_PL_PAR_SIZE[sync->dec->size_nr] - sync->dec->length;
+
+                if (n > len - i)
+                {
+                    n = len - i;
+                }
+            }
+
+            if (sync->shift > 0)
+            {
+                if (n > NGH_SYNC_BLOCK_SIZE)
+                {
+                    n = NGH_SYNC_BLOCK_SIZE;
+                }
+
+                for(j=0; j<n; j++)
+                {
+                    block[j] = (sync->carry << (8 - sync->shift)) | (raw[j] >> sync->shift);
+                    sync->carry = raw[j] & ((1 << sync->shift) - 1);
+                }
+
+                src = block;
+            }
+
+            if (replaying)
+            {
+                sync->replay_pos += n;
+            }
+            else
+            {
+                i += n;
+            }
+
+            // The search register is left at the sync. word, and the tag bytes are kept to search them again
+            if ((sync->dec->state != NGH_STATE_SIZE_KNOWN) && (sync->tag_raw_len < NGH_SIZE_TAG_SIZE))
+            {
+                sync->tag_raw[sync->tag_raw_len++] = raw[0];
+            }
+
+            state = ngham_decode_block(sync->dec, src, n, &used, msg, msg_len);
+
+            if (state != PKT_CONDITION_PREFAIL)
+            {
+                // End of the packet (decoded or failed): back to the search, from the bits after it
+                sync->locked = 0;
+                sync->reg = sync->carry;
+                sync->reg_top = 0;
+                sync->reg_bits = sync->shift;
+
+                break;
+            }
+            else if (sync->dec->state == NGH_STATE_SIZE_TAG)
+            {
+                ngham_sync_reject(sync);
+            }
+        }
+    }
+
+    *consumed = i;
+
+    return state;
+}
+
+//! \} End of ngham_sync implementation group
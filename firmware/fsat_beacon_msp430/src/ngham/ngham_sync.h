@@ -0,0 +1,111 @@
+/*
+ * ngham_sync.h
+ *
+ * Copyright (C) 2017, Gabriel Mariano Marcelino
+ *
+ * This file is part of FloripaSat-TTC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; if not, see <http://www.gnu.org/licenses/>
+ *
+ */
+
+/**
+ * \brief Bit-level sync. word search.
+ *
+ * Finds the NGHam sync. word at any bit offset of a raw bit stream (ex.: ground station captures, UART radio simulator),
+ * and feeds the byte-aligned packet that follows it into a decoder context.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \defgroup ngham_sync Sync. Search
+ * \ingroup ngham
+ * \{
+ */
+
+#ifndef NGHAM_SYNC_H_
+#define NGHAM_SYNC_H_
+
+#include <stdint.h>
+
+#include "ngham.h"
+
+/**
+ * \brief Maximum number of bytes realigned at once when the packet is not byte aligned in the stream.
+ */
+#define NGH_SYNC_BLOCK_SIZE             32
+
+/**
+ * \brief Default tolerance of the sync. word search (wrong bits).
+ */
+#define NGH_SYNC_MAX_ERROR              3
+
+/**
+ * \brief Sync. word search context.
+ */
+typedef struct
+{
+    NGHamDecoder *dec;                  /**< Decoder context fed with the aligned packet bytes. */
+    uint64_t sync_word;                 /**< Sync. word, right aligned. */
+    uint64_t sync_mask;                 /**< Bits of the search register compared with the sync. word. */
+    uint8_t sync_bits;                  /**< Length of the sync. word in bits (32 or 64). */
+    uint8_t max_errors;                 /**< Maximum number of wrong bits in a detected sync. word. */
+    uint64_t reg;                       /**< Last 64 received bits (the newest in the LSB). */
+    uint8_t reg_top;                    /**< The 8 bits received before the ones in reg. */
+    uint8_t reg_bits;                   /**< Number of valid bits in reg_top and reg (up to 72). */
+    uint8_t locked;                     /**< A sync. word was found and the following bytes go to the decoder. */
+    uint8_t shift;                      /**< Bit offset of the packet in the input bytes (0 = byte aligned). */
+    uint8_t carry;                      /**< Low "shift" bits of the last input byte (first bits of the next packet byte). */
+    uint8_t tag_raw[NGH_SIZE_TAG_SIZE]; /**< Input bytes fed to the size tag since the sync. word. */
+    uint8_t tag_raw_len;                /**< Number of bytes in tag_raw. */
+    uint8_t replay[NGH_SIZE_TAG_SIZE];  /**< Input bytes of a rejected size tag, searched again before the new input. */
+    uint8_t replay_len;                 /**< Number of bytes in replay. */
+    uint8_t replay_pos;                 /**< Next byte of replay. */
+} NGHamSync;
+
+/**
+ * \brief Sync. word search initialization.
+ *
+ * \param *sync is the sync. search context.
+ * \param *dec is the decoder context to feed with the packets.
+ * \param four_level selects the four-level sync. word (NGH_SYNC_FOUR_LEVEL) instead of NGH_SYNC.
+ * \param max_errors is the maximum number of wrong bits in a detected sync. word.
+ *
+ * \return None
+ */
+void ngham_sync_init(NGHamSync *sync, NGHamDecoder *dec, uint8_t four_level, uint8_t max_errors);
+
+/**
+ * \brief Pushes raw received bytes (MSB first, any bit alignment) into a sync. search context.
+ *
+ * The search stops at the end of each packet, so the remaining bytes must be pushed again. When a size tag is
+ * rejected, the search resumes right after the false sync. word, so a sync. word overlapping the tag is still found.
+ *
+ * \param *sync is the sync. search context.
+ * \param *data is the received bytes.
+ * \param len is the number of bytes in data.
+ * \param *consumed is the number of bytes of data used.
+ * \param *msg is the array to store the decoded payload.
+ * \param *msg_len is the length of the decoded payload.
+ *
+ * \return The decodification state (PKT_CONDITION_PREFAIL if no packet was finished).
+ */
+uint8_t ngham_sync_push(NGHamSync *sync, const uint8_t *data, uint16_t len, uint16_t *consumed, uint8_t *msg, uint8_t *msg_len);
+
+#endif // NGHAM_SYNC_H_
+
+//! \} End of ngham_sync group
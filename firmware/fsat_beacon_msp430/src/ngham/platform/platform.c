@@ -42,12 +42,6 @@
 
 #include <stdint.h>
 
-// Temporary buffer for the decoder, rx packet variable and state variable.
-uint8_t rx_buf[255];	// Should hold the largest packet - ie. 255 B
-uint16_t rx_buf_len;
-NGHam_RX_Packet rx_pkt;
-uint8_t decoder_state;
-
 uint8_t ngham_action_get_rssi()
 {
     return RSSI_NA;
@@ -63,23 +57,6 @@ void ngham_action_set_packet_size(uint8_t size)
     
 }
 
-void ngham_action_send_data(uint8_t *d, uint16_t d_len, uint8_t priority, uint8_t *pkt, uint16_t *pkt_len)
-{
-    int16_t i = 0;
-    switch (priority)
-    {
-        case PKT_PRIORITY_NORMAL:
-            for(i=0;i<d_len;i++)
-            {
-                pkt[i] = d[i];
-            }
-            *pkt_len = d_len;
-            break;
-        case PKT_PRIORITY_FIRST_IN_SLOT:
-            break;
-    }
-}
-
 void ngham_action_handle_packet(uint8_t condition, NGHam_RX_Packet *p, uint8_t *msg, uint8_t *msg_len)
 {
     uint8_t i = 0;
@@ -101,9 +78,6 @@ void ngham_action_handle_packet(uint8_t condition, NGHam_RX_Packet *p, uint8_t *
             // Count as fail and prepare for new sync word immediately
             break;
     }
-
-    // Reset RX packet content
-    ngham_rx_pkt_init(&rx_pkt);
 }
 
 void ngham_action_reception_started()
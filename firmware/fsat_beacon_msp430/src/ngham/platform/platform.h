@@ -50,25 +50,12 @@
  */
 #define NGHAM_BYTES_TILL_ACTION_HALFWAY 10	
 
-extern uint8_t rx_buf[];        /**< Should hold the largest packet - ie. 255 B. */
-extern uint16_t rx_buf_len;
-extern NGHam_RX_Packet rx_pkt;
-extern uint8_t decoder_state;
-
 /**
- * \brief Data to be transmitted (to modulator).
- * 
- * Priority can be ignored if NGHam is not used for timing purposes.
+ * \brief Maximum RAM, in bytes, of a NGHam decoder context (checked at compile time).
  * 
- * \param *d
- * \param d_len
- * \param priority
- * \param *pkt
- * \param *pkt_len
- * 
- * \return None
+ * The Reed Solomon control blocks and tables are constants in flash, so only the decoder buffers and state count.
  */
-void ngham_action_send_data(uint8_t *d, uint16_t d_len, uint8_t priority, uint8_t *pkt, uint16_t *pkt_len);
+#define NGHAM_RAM_MAX                   1024
 
 /**
  * \brief Set packet size demodulator, if applicable, to make the demodulator stop outputting data when the packet is finished.
@@ -97,6 +84,7 @@ uint8_t ngham_action_get_noise_floor();
  * \brief Will always be called after packet reception is finished - whether it was successful or not.
  * 
  * This function should also handle reinitialization of your decoder/sync word detector.
+ * The decoder context resets p after this call.
  * 
  * \param condition
  * \param *p
@@ -0,0 +1,144 @@
+/*
+ * packet_builder.c
+ *
+ * Copyright (C) 2017, Universidade Federal de Santa Catarina
+ *
+ * This file is part of FloripaSat-Beacon.
+ *
+ * FloripaSat-Beacon is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-Beacon is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-Beacon. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Packet builder implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \addtogroup packet_builder
+ * \{
+ */
+
+#include <stddef.h>
+
+#include "packet_builder.h"
+
+void packet_builder_init(PacketBuilder *pb, uint8_t *buf, uint16_t size, uint16_t headroom)
+{
+    if (headroom > size)
+    {
+        headroom = size;
+    }
+
+    pb->buf     = buf;
+    pb->size    = size;
+    pb->head    = headroom;
+    pb->tail    = headroom;
+}
+
+uint8_t *packet_builder_put(PacketBuilder *pb, uint16_t len)
+{
+    uint8_t *p = NULL;
+
+    if (len <= packet_builder_tailroom(pb))
+    {
+        p = &pb->buf[pb->tail];
+        pb->tail += len;
+    }
+
+    return p;
+}
+
+uint8_t *packet_builder_push(PacketBuilder *pb, uint16_t len)
+{
+    if (len > pb->head)
+    {
+        return NULL;
+    }
+
+    pb->head -= len;
+
+    return &pb->buf[pb->head];
+}
+
+bool packet_builder_append(PacketBuilder *pb, const uint8_t *data, uint16_t len)
+{
+    uint8_t *p = packet_builder_put(pb, len);
+    uint16_t i = 0;
+
+    if (p == NULL)
+    {
+        return false;
+    }
+
+    for(i=0; i<len; i++)
+    {
+        p[i] = data[i];
+    }
+
+    return true;
+}
+
+bool packet_builder_append_byte(PacketBuilder *pb, uint8_t byte)
+{
+    return packet_builder_append(pb, &byte, 1);
+}
+
+bool packet_builder_append_field(PacketBuilder *pb, const uint8_t *data, uint16_t len, uint16_t width, uint8_t fill)
+{
+    uint8_t *p = packet_builder_put(pb, width);
+    uint16_t i = 0;
+
+    if (p == NULL)
+    {
+        return false;
+    }
+
+    if (len > width)
+    {
+        len = width;
+    }
+
+    for(i=0; i<width-len; i++)
+    {
+        p[i] = fill;
+    }
+
+    for(i=0; i<len; i++)
+    {
+        p[width-len+i] = data[i];
+    }
+
+    return true;
+}
+
+uint8_t *packet_builder_data(PacketBuilder *pb)
+{
+    return &pb->buf[pb->head];
+}
+
+uint16_t packet_builder_len(PacketBuilder *pb)
+{
+    return pb->tail - pb->head;
+}
+
+uint16_t packet_builder_tailroom(PacketBuilder *pb)
+{
+    return pb->size - pb->tail;
+}
+
+//! \} End of packet_builder group
@@ -0,0 +1,152 @@
+/*
+ * packet_builder.h
+ *
+ * Copyright (C) 2017, Universidade Federal de Santa Catarina
+ *
+ * This file is part of FloripaSat-Beacon.
+ *
+ * FloripaSat-Beacon is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * FloripaSat-Beacon is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with FloripaSat-Beacon. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Packet builder.
+ *
+ * A frame under construction in a single buffer. The payload is written after a reserved headroom, and each
+ * protocol then prepends its header into the headroom and appends its trailer after the payload, in place.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 1.0-dev
+ *
+ * \date 18/10/2026
+ *
+ * \defgroup packet_builder Packet Builder
+ * \ingroup system
+ * \{
+ */
+
+#ifndef PACKET_BUILDER_H_
+#define PACKET_BUILDER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \brief A frame being built in a buffer.
+ */
+typedef struct
+{
+    uint8_t *buf;                   /**< Frame buffer. */
+    uint16_t size;                  /**< Size of the frame buffer. */
+    uint16_t head;                  /**< Position of the first byte of the frame. */
+    uint16_t tail;                  /**< Position after the last byte of the frame. */
+} PacketBuilder;
+
+/**
+ * \brief Packet builder initialization (empty frame).
+ *
+ * \param pb is a pointer to a PacketBuilder struct.
+ * \param buf is the frame buffer.
+ * \param size is the size of the frame buffer.
+ * \param headroom is the number of bytes reserved before the payload for the headers.
+ *
+ * \return None.
+ */
+void packet_builder_init(PacketBuilder *pb, uint8_t *buf, uint16_t size, uint16_t headroom);
+
+/**
+ * \brief Reserves bytes at the end of the frame.
+ *
+ * \param pb is a pointer to a PacketBuilder struct.
+ * \param len is the number of bytes.
+ *
+ * \return A pointer to the reserved bytes, or NULL if they do not fit in the buffer.
+ */
+uint8_t *packet_builder_put(PacketBuilder *pb, uint16_t len);
+
+/**
+ * \brief Reserves bytes at the beginning of the frame (in the headroom).
+ *
+ * \param pb is a pointer to a PacketBuilder struct.
+ * \param len is the number of bytes.
+ *
+ * \return A pointer to the reserved bytes, or NULL if the headroom is too small.
+ */
+uint8_t *packet_builder_push(PacketBuilder *pb, uint16_t len);
+
+/**
+ * \brief Appends data to the end of the frame.
+ *
+ * \param pb is a pointer to a PacketBuilder struct.
+ * \param data is a pointer to an array with the data to append.
+ * \param len is the length of data.
+ *
+ * \return True/False if the data fits into the buffer (nothing is appended otherwise).
+ */
+bool packet_builder_append(PacketBuilder *pb, const uint8_t *data, uint16_t len);
+
+/**
+ * \brief Appends a single byte to the end of the frame.
+ *
+ * \param pb is a pointer to a PacketBuilder struct.
+ * \param byte is the byte to append.
+ *
+ * \return True/False if the byte fits into the buffer.
+ */
+bool packet_builder_append_byte(PacketBuilder *pb, uint8_t byte);
+
+/**
+ * \brief Appends data to the end of the frame, right aligned in a fixed width field.
+ *
+ * \param pb is a pointer to a PacketBuilder struct.
+ * \param data is a pointer to an array with the data to append (truncated to width bytes).
+ * \param len is the length of data.
+ * \param width is the length of the field.
+ * \param fill is the byte that fills the field before the data.
+ *
+ * \return True/False if the field fits into the buffer (nothing is appended otherwise).
+ */
+bool packet_builder_append_field(PacketBuilder *pb, const uint8_t *data, uint16_t len, uint16_t width, uint8_t fill);
+
+/**
+ * \brief Returns the first byte of the frame.
+ *
+ * \param pb is a pointer to a PacketBuilder struct.
+ *
+ * \return A pointer to the frame.
+ */
+uint8_t *packet_builder_data(PacketBuilder *pb);
+
+/**
+ * \brief Returns the length of the frame.
+ *
+ * \param pb is a pointer to a PacketBuilder struct.
+ *
+ * \return The length of the frame.
+ */
+uint16_t packet_builder_len(PacketBuilder *pb);
+
+/**
+ * \brief Returns the number of free bytes after the frame.
+ *
+ * \param pb is a pointer to a PacketBuilder struct.
+ *
+ * \return The free bytes at the end of the buffer.
+ */
+uint16_t packet_builder_tailroom(PacketBuilder *pb);
+
+#endif // PACKET_BUILDER_H_
+
+//! \} End of packet_builder group
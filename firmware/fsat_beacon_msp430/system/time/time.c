@@ -37,6 +37,7 @@
 #include <drivers/driverlib/driverlib.h>
 #include <system/debug/debug.h>
 #include <hal/mcu/flash.h>
+#include <src/crc/crc.h>
 
 #include "time.h"
 #include "time_config.h"
@@ -86,20 +87,7 @@ static uint8_t time_crc8(uint32_t time_counter)
     time_in_bytes[2] = (uint8_t)((time_counter & 0x0000FF00) >> 8);
     time_in_bytes[3] = (uint8_t)(time_counter & 0x000000FF);
     
-    uint8_t crc = TIME_CRC8_INITIAL_VALUE;
-    uint8_t i = 0;
-    for(i=0; i<(32/8); i++)
-    {
-        crc ^= time_in_bytes[i];
-        uint8_t j = 0;
-        for (j=0; j<8; j++)
-        {
-            crc = (crc << 1) ^ ((crc & 0x80)? TIME_CRC8_POLYNOMIAL: 0);
-        }
-        crc &= 0xFF;
-    }
-    
-    return crc;
+    return crc8(TIME_CRC8_INITIAL_VALUE, TIME_CRC8_POLYNOMIAL, time_in_bytes, 4);
 }
 
 static void time_save()